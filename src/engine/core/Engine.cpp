@@ -1,6 +1,7 @@
 #include "Engine.hpp"
 
 #include "components/Renderable.hpp"
+#include "core/JobSystem.hpp"
 #include "core/World.hpp"
 #include "logging/logger.hpp"
 #include "rendering/Renderer.hpp"
@@ -15,6 +16,7 @@ World* Engine::s_world{ nullptr };
 
 void Engine::Initialize(const Window& window)
 {
+    JobSystem::Initialize();
     VkContext::Initialize(window);
 
     s_world = new class World();
@@ -37,6 +39,8 @@ void Engine::Shutdown()
 
     s_renderer = nullptr;
     s_world = nullptr;
+
+    JobSystem::Shutdown();
 }
 
 void Engine::Update()
@@ -45,6 +49,7 @@ void Engine::Update()
 
     auto query{ s_world->Registry().QueryAll<Renderable>() };
     s_renderer->SetEntities(RendererEntity::MESH_OPAQUE, query);
+    s_renderer->PublishSnapshot();
 
     s_renderer->Update();
 }
@@ -5,6 +5,8 @@
 
 #include <xxhash.h>
 
+#include <cstddef>
+
 namespace Zeus
 {
 using Hash = XXH32_hash_t;
@@ -34,6 +36,11 @@ public:
         return XXH32(&input, sizeof(T), SEED);
     }
 
+    inline static Hash Digest(const void* data, std::size_t size)
+    {
+        return XXH32(data, size, SEED);
+    }
+
 private:
     static constexpr XXH32_hash_t SEED{ 0 };
 
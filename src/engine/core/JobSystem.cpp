@@ -0,0 +1,252 @@
+#include "JobSystem.hpp"
+
+#include "logging/logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace Zeus
+{
+namespace
+{
+struct WorkerQueue
+{
+    std::mutex mutex;
+    std::deque<Job> jobs;
+};
+
+std::vector<std::unique_ptr<WorkerQueue>> s_queues{};
+std::vector<std::thread> s_workers{};
+
+// Idle workers block on this counter while it is zero.
+std::atomic<std::uint32_t> s_pendingJobs{ 0 };
+std::atomic<bool> s_running{ false };
+
+thread_local std::uint32_t t_threadIndex{ 0 };
+
+std::optional<Job> PopBack(WorkerQueue& queue)
+{
+    std::lock_guard lock{ queue.mutex };
+
+    if (queue.jobs.empty())
+        return std::nullopt;
+
+    Job job{ queue.jobs.back() };
+    queue.jobs.pop_back();
+
+    return job;
+}
+
+std::optional<Job> PopFront(WorkerQueue& queue)
+{
+    std::lock_guard lock{ queue.mutex };
+
+    if (queue.jobs.empty())
+        return std::nullopt;
+
+    Job job{ queue.jobs.front() };
+    queue.jobs.pop_front();
+
+    return job;
+}
+}
+
+void JobSystem::Initialize(std::uint32_t workerCount)
+{
+    assert(!IsInitialized() && "Job system is already initialized");
+
+    LOG_DEBUG("Initializing job system with {} workers.", workerCount);
+
+    s_queues.clear();
+    for (std::uint32_t i{ 0 }; i < workerCount + 1u; ++i)
+    {
+        s_queues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    s_running.store(true, std::memory_order_release);
+    t_threadIndex = 0;
+
+    for (std::uint32_t i{ 1 }; i < workerCount + 1u; ++i)
+    {
+        s_workers.emplace_back(WorkerLoop, i);
+    }
+}
+
+void JobSystem::Shutdown()
+{
+    if (!IsInitialized())
+        return;
+
+    s_running.store(false, std::memory_order_release);
+
+    // Wake up sleeping workers so they can observe the shutdown.
+    s_pendingJobs.fetch_add(1, std::memory_order_release);
+    s_pendingJobs.notify_all();
+
+    for (std::thread& worker : s_workers)
+    {
+        worker.join();
+    }
+
+    s_workers.clear();
+    s_queues.clear();
+    s_pendingJobs.store(0, std::memory_order_release);
+}
+
+bool JobSystem::IsInitialized()
+{
+    return s_running.load(std::memory_order_acquire);
+}
+
+std::uint32_t JobSystem::DefaultWorkerCount()
+{
+    const std::uint32_t hardwareThreads{ std::thread::hardware_concurrency() };
+    return std::max(hardwareThreads, 2u) - 1u;
+}
+
+std::uint32_t JobSystem::ThreadCount()
+{
+    return std::max(static_cast<std::uint32_t>(s_queues.size()), 1u);
+}
+
+std::uint32_t JobSystem::ThreadIndex()
+{
+    return t_threadIndex;
+}
+
+void JobSystem::Execute(const Job& job, JobCounter* dependency)
+{
+    if (job.counter != nullptr)
+        job.counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    if (dependency != nullptr)
+    {
+        std::lock_guard lock{ dependency->m_mutex };
+
+        // Checked under the lock, Release takes the continuations with it.
+        if (!dependency->IsDone())
+        {
+            dependency->m_continuations.push_back(job);
+            return;
+        }
+    }
+
+    Push(job);
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!RunPendingJob(t_threadIndex))
+            std::this_thread::yield();
+    }
+
+    // The last job may still hold the lock while releasing continuations.
+    std::lock_guard lock{ counter.m_mutex };
+}
+
+bool JobSystem::RunPendingJob(std::uint32_t threadIndex)
+{
+    if (!IsInitialized())
+        return false;
+
+    std::optional<Job> job{ PopBack(*s_queues[threadIndex]) };
+
+    // Steal from the other threads, starting with the next one so that
+    // thieves spread over the queues.
+    const auto queueCount{ static_cast<std::uint32_t>(s_queues.size()) };
+    for (std::uint32_t i{ 1 }; !job && i < queueCount; ++i)
+    {
+        job = PopFront(*s_queues[(threadIndex + i) % queueCount]);
+    }
+
+    if (!job)
+        return false;
+
+    s_pendingJobs.fetch_sub(1, std::memory_order_acq_rel);
+    Run(*job);
+
+    return true;
+}
+
+void JobSystem::WorkerLoop(std::uint32_t threadIndex)
+{
+    t_threadIndex = threadIndex;
+
+    while (IsInitialized())
+    {
+        if (RunPendingJob(threadIndex))
+            continue;
+
+        s_pendingJobs.wait(0, std::memory_order_acquire);
+    }
+}
+
+void JobSystem::Push(const Job& job)
+{
+    if (!IsInitialized())
+    {
+        Run(job);
+        return;
+    }
+
+    WorkerQueue& queue{ *s_queues[t_threadIndex] };
+    {
+        std::lock_guard lock{ queue.mutex };
+        queue.jobs.push_back(job);
+    }
+
+    s_pendingJobs.fetch_add(1, std::memory_order_release);
+    s_pendingJobs.notify_one();
+}
+
+void JobSystem::Run(const Job& job)
+{
+    job.function(job.data, job.begin, job.end);
+
+    if (job.counter == nullptr)
+        return;
+
+    // Decrement without the lock unless this may be the last job.
+    JobCounter& counter{ *job.counter };
+    std::uint32_t pending{ counter.m_pending.load(std::memory_order_relaxed) };
+
+    while (pending > 1u)
+    {
+        if (counter.m_pending.compare_exchange_weak(
+                pending,
+                pending - 1u,
+                std::memory_order_acq_rel,
+                std::memory_order_relaxed))
+            return;
+    }
+
+    Release(counter);
+}
+
+void JobSystem::Release(JobCounter& counter)
+{
+    std::vector<Job> continuations{};
+    {
+        std::lock_guard lock{ counter.m_mutex };
+
+        if (counter.m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1u)
+            continuations.swap(counter.m_continuations);
+    }
+
+    // The counter may be gone by now, only the local copies are used.
+    for (const Job& continuation : continuations)
+    {
+        Push(continuation);
+    }
+}
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace Zeus
+{
+struct Job;
+
+// Counts the unfinished jobs of a group. Jobs scheduled with the counter as
+// dependency are held back until it drops to zero, which is how job graphs
+// are expressed. Wait on a counter before destroying it.
+class JobCounter
+{
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const
+    {
+        return m_pending.load(std::memory_order_acquire) == 0;
+    }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<std::uint32_t> m_pending{ 0 };
+
+    mutable std::mutex m_mutex;
+    std::vector<Job> m_continuations;
+};
+
+struct Job
+{
+    void (*function)(void* data, std::uint32_t begin, std::uint32_t end);
+    void* data;
+    std::uint32_t begin;
+    std::uint32_t end;
+    JobCounter* counter;
+};
+
+// Work-stealing thread pool. Every thread owns a deque, it pushes and pops
+// its own jobs from the back while idle threads steal from the front.
+// Threads that are not workers share the first deque.
+// When the system is not initialized jobs run inline on the caller.
+class JobSystem
+{
+public:
+    static constexpr std::uint32_t DEFAULT_BATCH_SIZE{ 1024 };
+
+    static void Initialize(std::uint32_t workerCount = DefaultWorkerCount());
+    static void Shutdown();
+
+    static bool IsInitialized();
+    static std::uint32_t DefaultWorkerCount();
+
+    // Workers plus the thread that initialized the system.
+    static std::uint32_t ThreadCount();
+    static std::uint32_t ThreadIndex();
+
+    // The job starts once the dependency, if any, has dropped to zero.
+    // Its own counter is raised right away so waiting on it covers the
+    // deferred job as well.
+    static void Execute(const Job& job, JobCounter* dependency = nullptr);
+
+    // Runs pending jobs on the calling thread until the counter drops to zero.
+    static void Wait(const JobCounter& counter);
+
+    // Job calling function(begin, end), the function must outlive the job.
+    template <typename Func>
+    static Job MakeJob(
+        Func& function,
+        std::uint32_t begin,
+        std::uint32_t end,
+        JobCounter* counter)
+    {
+        using FunctionType = std::remove_const_t<Func>;
+
+        return Job{
+            .function =
+                [](void* data, std::uint32_t first, std::uint32_t last) {
+                    (*static_cast<FunctionType*>(data))(first, last);
+                },
+            .data = const_cast<void*>(
+                static_cast<const void*>(std::addressof(function))),
+            .begin = begin,
+            .end = end,
+            .counter = counter,
+        };
+    }
+
+    // Non blocking ParallelFor, the batches are tracked by the counter and
+    // start once the dependency is done.
+    template <typename Func>
+    static void Dispatch(
+        std::uint32_t count,
+        std::uint32_t batchSize,
+        Func& function,
+        JobCounter& counter,
+        JobCounter* dependency = nullptr)
+    {
+        batchSize = std::max(batchSize, 1u);
+
+        for (std::uint32_t begin{ 0 }; begin < count; begin += batchSize)
+        {
+            Execute(
+                MakeJob(
+                    function,
+                    begin,
+                    std::min(begin + batchSize, count),
+                    &counter),
+                dependency);
+        }
+    }
+
+    // Splits [0, count) into batches and calls function(begin, end) for each.
+    // Returns once every batch has finished.
+    template <typename Func>
+    static void ParallelFor(
+        std::uint32_t count,
+        std::uint32_t batchSize,
+        Func&& function)
+    {
+        batchSize = std::max(batchSize, 1u);
+
+        if (!IsInitialized() || count <= batchSize)
+        {
+            if (count > 0)
+                function(0u, count);
+
+            return;
+        }
+
+        JobCounter counter;
+        Dispatch(count, batchSize, function, counter);
+        Wait(counter);
+    }
+
+private:
+    static void Push(const Job& job);
+    static void Run(const Job& job);
+    static void Release(JobCounter& counter);
+    static bool RunPendingJob(std::uint32_t threadIndex);
+    static void WorkerLoop(std::uint32_t threadIndex);
+};
+}
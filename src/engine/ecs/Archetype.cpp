@@ -0,0 +1,268 @@
+#include "Archetype.hpp"
+
+#include "ComponentInfo.hpp"
+#include "Entity.hpp"
+#include "memory/memory.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace Zeus::ECS
+{
+Archetype::Archetype(std::vector<const ComponentInfo*>&& components)
+    : m_components{ std::move(components) },
+      m_signature{},
+      m_offsets{},
+      m_chunkCapacity{ 0 },
+      m_chunkBytes{ 0 },
+      m_chunks{},
+      m_size{ 0 },
+      m_addEdges{},
+      m_removeEdges{}
+{
+    assert(
+        std::is_sorted(
+            m_components.begin(),
+            m_components.end(),
+            [](const auto* left, const auto* right) {
+                return left->family < right->family;
+            }) &&
+        "Components are not sorted");
+
+    std::size_t rowSize{ sizeof(Entity) };
+    for (const auto* component : m_components)
+    {
+        assert(component->alignment <= CHUNK_ALIGNMENT);
+
+        m_signature.push_back(component->family);
+        rowSize += component->size;
+    }
+
+    // Columns are laid out one after another, each aligned to its component.
+    // Start from the upper bound and shrink until the padding fits as well.
+    auto layout = [this](std::size_t capacity) {
+        std::size_t offset{ capacity * sizeof(Entity) };
+
+        for (std::size_t i{ 0 }; i < m_components.size(); ++i)
+        {
+            offset = alignUp(offset, m_components[i]->alignment);
+            m_offsets[i] = offset;
+            offset += capacity * m_components[i]->size;
+        }
+
+        return offset;
+    };
+
+    m_offsets.resize(m_components.size());
+    m_chunkCapacity = std::max(CHUNK_SIZE / rowSize, std::size_t{ 1 });
+    m_chunkBytes = layout(m_chunkCapacity);
+
+    while (m_chunkCapacity > 1 && m_chunkBytes > CHUNK_SIZE)
+        m_chunkBytes = layout(--m_chunkCapacity);
+
+    m_chunkBytes = std::max(m_chunkBytes, CHUNK_SIZE);
+}
+
+Archetype::~Archetype()
+{
+    Clear();
+
+    for (std::byte* chunk : m_chunks)
+        ::operator delete(chunk, std::align_val_t{ CHUNK_ALIGNMENT });
+}
+
+std::size_t Archetype::Allocate(Entity entity)
+{
+    const std::size_t row{ m_size };
+
+    if (row / m_chunkCapacity == m_chunks.size())
+    {
+        m_chunks.push_back(static_cast<std::byte*>(::operator new(
+            m_chunkBytes,
+            std::align_val_t{ CHUNK_ALIGNMENT })));
+    }
+
+    ++m_size;
+
+    EntityRef(row) = entity;
+
+    return row;
+}
+
+void Archetype::Remove(std::size_t row)
+{
+    assert(row < m_size && "Row is out of bounds");
+
+    const std::size_t last{ m_size - 1 };
+
+    for (std::size_t column{ 0 }; column < m_components.size(); ++column)
+    {
+        const ComponentInfo& info{ *m_components[column] };
+        info.destroy(At(column, row));
+
+        if (row != last)
+        {
+            info.moveConstruct(At(column, row), At(column, last));
+            info.destroy(At(column, last));
+        }
+    }
+
+    if (row != last)
+    {
+        EntityRef(row) = EntityRef(last);
+    }
+
+    --m_size;
+}
+
+void Archetype::MoveTo(
+    std::size_t row,
+    Archetype& destination,
+    std::size_t destinationRow)
+{
+    assert(row < m_size && destinationRow < destination.m_size);
+
+    for (std::size_t column{ 0 }; column < m_components.size(); ++column)
+    {
+        const std::size_t destinationColumn{ destination.Column(
+            m_signature[column]) };
+
+        if (destinationColumn == INVALID_COLUMN)
+            continue;
+
+        m_components[column]->moveConstruct(
+            destination.At(destinationColumn, destinationRow),
+            At(column, row));
+    }
+}
+
+void Archetype::Clear()
+{
+    for (std::size_t row{ 0 }; row < m_size; ++row)
+    {
+        for (std::size_t column{ 0 }; column < m_components.size(); ++column)
+        {
+            m_components[column]->destroy(At(column, row));
+        }
+    }
+
+    m_size = 0;
+}
+
+std::size_t Archetype::Column(Family family) const
+{
+    // Signatures are short, a linear scan beats a binary search here.
+    for (std::size_t i{ 0 }; i < m_signature.size(); ++i)
+    {
+        if (m_signature[i] == family)
+            return i;
+    }
+
+    return INVALID_COLUMN;
+}
+
+bool Archetype::Has(Family family) const
+{
+    return Column(family) != INVALID_COLUMN;
+}
+
+bool Archetype::HasAll(const Family* families, std::size_t count) const
+{
+    for (std::size_t i{ 0 }; i < count; ++i)
+    {
+        if (!Has(families[i]))
+            return false;
+    }
+
+    return true;
+}
+
+void* Archetype::At(std::size_t column, std::size_t row) const
+{
+    return m_chunks[row / m_chunkCapacity] + m_offsets[column] +
+           (row % m_chunkCapacity) * m_components[column]->size;
+}
+
+Entity Archetype::EntityAt(std::size_t row) const
+{
+    assert(row < m_size && "Row is out of bounds");
+    return Entities(row / m_chunkCapacity)[row % m_chunkCapacity];
+}
+
+std::size_t Archetype::Size() const
+{
+    return m_size;
+}
+
+bool Archetype::Empty() const
+{
+    return m_size == 0;
+}
+
+std::size_t Archetype::ChunkCapacity() const
+{
+    return m_chunkCapacity;
+}
+
+std::size_t Archetype::ChunkCount() const
+{
+    return (m_size + m_chunkCapacity - 1) / m_chunkCapacity;
+}
+
+std::size_t Archetype::ChunkSize(std::size_t chunk) const
+{
+    assert(chunk < ChunkCount() && "Chunk is out of bounds");
+    return std::min(m_size - chunk * m_chunkCapacity, m_chunkCapacity);
+}
+
+const Entity* Archetype::Entities(std::size_t chunk) const
+{
+    return reinterpret_cast<const Entity*>(m_chunks[chunk]);
+}
+
+void* Archetype::Data(std::size_t chunk, std::size_t column) const
+{
+    return m_chunks[chunk] + m_offsets[column];
+}
+
+const std::vector<Family>& Archetype::Signature() const
+{
+    return m_signature;
+}
+
+const std::vector<const ComponentInfo*>& Archetype::Components() const
+{
+    return m_components;
+}
+
+Archetype* Archetype::AddEdge(Family family) const
+{
+    auto edge{ m_addEdges.find(family) };
+    return edge != m_addEdges.end() ? edge->second : nullptr;
+}
+
+Archetype* Archetype::RemoveEdge(Family family) const
+{
+    auto edge{ m_removeEdges.find(family) };
+    return edge != m_removeEdges.end() ? edge->second : nullptr;
+}
+
+void Archetype::SetAddEdge(Family family, Archetype* archetype)
+{
+    m_addEdges[family] = archetype;
+}
+
+void Archetype::SetRemoveEdge(Family family, Archetype* archetype)
+{
+    m_removeEdges[family] = archetype;
+}
+
+Entity& Archetype::EntityRef(std::size_t row)
+{
+    return reinterpret_cast<Entity*>(
+        m_chunks[row / m_chunkCapacity])[row % m_chunkCapacity];
+}
+}
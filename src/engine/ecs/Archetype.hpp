@@ -0,0 +1,89 @@
+#pragma once
+
+#include "ComponentInfo.hpp"
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Stores all entities sharing the same component signature. Rows live in
+// fixed-size chunks with one contiguous array (column) per component, so
+// iterating an archetype is a linear walk over SoA arrays.
+class Archetype
+{
+public:
+    static constexpr std::size_t CHUNK_SIZE{ 16384 };
+    static constexpr std::size_t CHUNK_ALIGNMENT{ 64 };
+    static constexpr std::size_t INVALID_COLUMN{
+        std::numeric_limits<std::size_t>::max()
+    };
+
+    // Components have to be sorted by family.
+    Archetype(std::vector<const ComponentInfo*>&& components);
+    ~Archetype();
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    // Reserves a row for the entity. Component memory of the row is left
+    // uninitialized and has to be constructed by the caller.
+    std::size_t Allocate(Entity entity);
+
+    // Destroys components of the row and fills the hole with the last row.
+    void Remove(std::size_t row);
+
+    // Moves components shared with the destination archetype into its row.
+    // Moved-from components are left in place and destroyed by Remove.
+    void MoveTo(
+        std::size_t row,
+        Archetype& destination,
+        std::size_t destinationRow);
+
+    void Clear();
+
+    std::size_t Column(Family family) const;
+    bool Has(Family family) const;
+    bool HasAll(const Family* families, std::size_t count) const;
+
+    void* At(std::size_t column, std::size_t row) const;
+    Entity EntityAt(std::size_t row) const;
+
+    std::size_t Size() const;
+    bool Empty() const;
+    std::size_t ChunkCapacity() const;
+    std::size_t ChunkCount() const;
+    std::size_t ChunkSize(std::size_t chunk) const;
+
+    const Entity* Entities(std::size_t chunk) const;
+    void* Data(std::size_t chunk, std::size_t column) const;
+
+    const std::vector<Family>& Signature() const;
+    const std::vector<const ComponentInfo*>& Components() const;
+
+    Archetype* AddEdge(Family family) const;
+    Archetype* RemoveEdge(Family family) const;
+    void SetAddEdge(Family family, Archetype* archetype);
+    void SetRemoveEdge(Family family, Archetype* archetype);
+
+private:
+    Entity& EntityRef(std::size_t row);
+
+private:
+    std::vector<const ComponentInfo*> m_components;
+    std::vector<Family> m_signature;
+    std::vector<std::size_t> m_offsets;
+
+    std::size_t m_chunkCapacity;
+    std::size_t m_chunkBytes;
+    std::vector<std::byte*> m_chunks;
+    std::size_t m_size;
+
+    std::unordered_map<Family, Archetype*> m_addEdges;
+    std::unordered_map<Family, Archetype*> m_removeEdges;
+};
+}
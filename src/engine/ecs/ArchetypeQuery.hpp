@@ -0,0 +1,125 @@
+#pragma once
+
+#include "ecs/Archetype.hpp"
+#include "ecs/ArchetypeQueryIterator.hpp"
+#include "ecs/ComponentInfo.hpp"
+#include "ecs/FamilyId.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Query over archetype storage. Matching archetypes are resolved once and
+// their chunks are walked linearly, no per entity membership checks.
+template <typename... Components>
+class ArchetypeQuery
+{
+public:
+    using iterator = ArchetypeQueryIterator<Components...>;
+    using Match = typename iterator::Match;
+
+    ArchetypeQuery(const std::vector<std::unique_ptr<Archetype>>& archetypes)
+        : m_archetypes{ archetypes },
+          m_matches{},
+          m_checked{ 0 }
+    {
+        Refresh();
+    }
+
+    // Picks up archetypes created since the last refresh.
+    void Refresh()
+    {
+        static const std::array<Family, sizeof...(Components)> families{
+            FamilyId::Type<Components>()...
+        };
+
+        for (; m_checked < m_archetypes.size(); ++m_checked)
+        {
+            Archetype* archetype{ m_archetypes[m_checked].get() };
+
+            if (!archetype->HasAll(families.data(), families.size()))
+                continue;
+
+            Match match{ .archetype = archetype, .columns = {} };
+            for (std::size_t i{ 0 }; i < families.size(); ++i)
+            {
+                match.columns[i] = archetype->Column(families[i]);
+            }
+
+            m_matches.push_back(match);
+        }
+    }
+
+    template <typename Func>
+    void Each(Func&& function)
+    {
+        Refresh();
+
+        for (const Match& match : m_matches)
+        {
+            for (std::size_t chunk{ 0 }; chunk < match.archetype->ChunkCount();
+                 ++chunk)
+            {
+                EachChunk(
+                    function,
+                    match,
+                    chunk,
+                    std::index_sequence_for<Components...>{});
+            }
+        }
+    }
+
+    std::size_t Size()
+    {
+        Refresh();
+
+        std::size_t size{ 0 };
+        for (const Match& match : m_matches)
+        {
+            size += match.archetype->Size();
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] iterator begin()
+    {
+        Refresh();
+        return iterator(m_matches, 0);
+    }
+
+    [[nodiscard]] iterator end()
+    {
+        return iterator(m_matches, m_matches.size());
+    }
+
+private:
+    template <typename Func, std::size_t... Index>
+    static void EachChunk(
+        Func& function,
+        const Match& match,
+        std::size_t chunk,
+        std::index_sequence<Index...>)
+    {
+        const std::size_t size{ match.archetype->ChunkSize(chunk) };
+
+        std::tuple<Components*...> columns{ static_cast<Components*>(
+            match.archetype->Data(chunk, match.columns[Index]))... };
+
+        for (std::size_t row{ 0 }; row < size; ++row)
+        {
+            function(std::get<Index>(columns)[row]...);
+        }
+    }
+
+private:
+    const std::vector<std::unique_ptr<Archetype>>& m_archetypes;
+    std::vector<Match> m_matches;
+    std::size_t m_checked;
+};
+}
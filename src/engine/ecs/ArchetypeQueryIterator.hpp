@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ecs/Archetype.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+namespace Zeus::ECS
+{
+template <typename... Components>
+class ArchetypeQueryIterator
+{
+public:
+    struct Match
+    {
+        Archetype* archetype;
+        std::array<std::size_t, sizeof...(Components)> columns;
+    };
+
+    ArchetypeQueryIterator(const std::vector<Match>& matches, std::size_t match)
+        : m_matches{ &matches },
+          m_match{ match },
+          m_row{ 0 }
+    {
+        SeekNext();
+    }
+
+    ArchetypeQueryIterator& operator++() noexcept
+    {
+        return ++m_row, SeekNext(), *this;
+    }
+
+    ArchetypeQueryIterator operator++(int) noexcept
+    {
+        const ArchetypeQueryIterator copy{ *this };
+        return operator++(), copy;
+    }
+
+    [[nodiscard]] decltype(auto) operator*() const noexcept
+    {
+        return Get(std::index_sequence_for<Components...>{});
+    }
+
+    bool operator==(const ArchetypeQueryIterator& other) const noexcept
+    {
+        return m_match == other.m_match && m_row == other.m_row;
+    }
+
+private:
+    template <std::size_t... Index>
+    decltype(auto) Get(std::index_sequence<Index...>) const noexcept
+    {
+        static_assert(sizeof...(Index) > 0);
+
+        const Match& match{ (*m_matches)[m_match] };
+
+        if constexpr (sizeof...(Index) == 1)
+            return (
+                *static_cast<Components*>(
+                    match.archetype->At(match.columns[Index], m_row)),
+                ...);
+        else
+            return std::forward_as_tuple(*static_cast<Components*>(
+                match.archetype->At(match.columns[Index], m_row))...);
+    }
+
+    void SeekNext() noexcept
+    {
+        while (m_match < m_matches->size() &&
+               m_row >= (*m_matches)[m_match].archetype->Size())
+        {
+            ++m_match;
+            m_row = 0;
+        }
+    }
+
+private:
+    const std::vector<Match>* m_matches;
+    std::size_t m_match;
+    std::size_t m_row;
+};
+}
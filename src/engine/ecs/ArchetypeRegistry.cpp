@@ -0,0 +1,166 @@
+#include "ArchetypeRegistry.hpp"
+
+#include "Archetype.hpp"
+#include "ComponentInfo.hpp"
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+ArchetypeRegistry::ArchetypeRegistry()
+    : m_archetypes{},
+      m_locations{},
+      m_entities{}
+{
+    // Entities without components live in the root archetype.
+    m_archetypes.push_back(
+        std::make_unique<Archetype>(std::vector<const ComponentInfo*>{}));
+}
+
+Entity ArchetypeRegistry::Create()
+{
+    Entity newEntity{ m_entities.Create() };
+    Place(newEntity);
+    return newEntity;
+}
+
+void ArchetypeRegistry::Destroy(const Entity entity)
+{
+    assert(IsValid(entity) && "Invalid entity");
+
+    const EntityLocation& location{ m_locations[entityIndex(entity)] };
+    RemoveRow(*location.archetype, location.row);
+
+    m_entities.Destroy(entity);
+}
+
+void ArchetypeRegistry::Clear()
+{
+    for (auto& archetype : m_archetypes)
+    {
+        archetype->Clear();
+    }
+
+    m_entities.Clear();
+}
+
+bool ArchetypeRegistry::IsValid(const Entity entity) const
+{
+    return m_entities.IsValid(entity);
+}
+
+std::size_t ArchetypeRegistry::ArchetypeCount() const
+{
+    return m_archetypes.size();
+}
+
+void ArchetypeRegistry::Insert(const Entity entity)
+{
+    assert(!m_entities.IsIssued(entity) && "Stale entity");
+
+    m_entities.Insert(entity);
+    Place(entity);
+}
+
+void ArchetypeRegistry::Place(const Entity entity)
+{
+    const Entity index{ entityIndex(entity) };
+
+    if (index >= m_locations.size())
+        m_locations.resize(index + 1u);
+
+    Archetype& root{ *m_archetypes.front() };
+    m_locations[index] = { .archetype = &root, .row = root.Allocate(entity) };
+}
+
+void ArchetypeRegistry::Erase(const Entity entity, Family family)
+{
+    assert(IsValid(entity) && "Invalid entity");
+
+    EntityLocation& location{ m_locations[entityIndex(entity)] };
+
+    assert(location.archetype->Has(family) && "Missing component");
+
+    Archetype* source{ location.archetype };
+    Archetype* destination{ RemoveEdge(*source, family) };
+
+    const std::size_t row{ destination->Allocate(entity) };
+    source->MoveTo(location.row, *destination, row);
+
+    RemoveRow(*source, location.row);
+    location = { .archetype = destination, .row = row };
+}
+
+void ArchetypeRegistry::RemoveRow(Archetype& archetype, std::size_t row)
+{
+    archetype.Remove(row);
+
+    // The last row has been moved into the hole, its entity has to follow.
+    if (row < archetype.Size())
+        m_locations[entityIndex(archetype.EntityAt(row))].row = row;
+}
+
+Archetype* ArchetypeRegistry::AddEdge(
+    Archetype& source,
+    const ComponentInfo& info)
+{
+    if (Archetype* edge{ source.AddEdge(info.family) })
+        return edge;
+
+    std::vector<const ComponentInfo*> components{ source.Components() };
+    components.insert(
+        std::upper_bound(
+            components.begin(),
+            components.end(),
+            info.family,
+            [](Family family, const ComponentInfo* component) {
+                return family < component->family;
+            }),
+        &info);
+
+    Archetype* destination{ FindOrCreate(std::move(components)) };
+    source.SetAddEdge(info.family, destination);
+    destination->SetRemoveEdge(info.family, &source);
+
+    return destination;
+}
+
+Archetype* ArchetypeRegistry::RemoveEdge(Archetype& source, Family family)
+{
+    if (Archetype* edge{ source.RemoveEdge(family) })
+        return edge;
+
+    std::vector<const ComponentInfo*> components{ source.Components() };
+    std::erase_if(components, [family](const ComponentInfo* component) {
+        return component->family == family;
+    });
+
+    Archetype* destination{ FindOrCreate(std::move(components)) };
+    source.SetRemoveEdge(family, destination);
+    destination->SetAddEdge(family, &source);
+
+    return destination;
+}
+
+Archetype* ArchetypeRegistry::FindOrCreate(
+    std::vector<const ComponentInfo*>&& components)
+{
+    // Only reached on an edge miss, the graph caches every transition.
+    for (auto& archetype : m_archetypes)
+    {
+        if (archetype->Components() == components)
+            return archetype.get();
+    }
+
+    return m_archetypes
+        .emplace_back(std::make_unique<Archetype>(std::move(components)))
+        .get();
+}
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Archetype.hpp"
+#include "ArchetypeQuery.hpp"
+#include "ComponentInfo.hpp"
+#include "Entity.hpp"
+#include "EntityPool.hpp"
+#include "FamilyId.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Alternative to Registry which groups entities by component signature.
+// Structural changes (Emplace/Erase) move the entity between archetypes, in
+// exchange multi-component queries iterate contiguous chunks only.
+class ArchetypeRegistry
+{
+public:
+    ArchetypeRegistry();
+
+    ArchetypeRegistry(const ArchetypeRegistry&) = delete;
+    ArchetypeRegistry& operator=(const ArchetypeRegistry&) = delete;
+
+    Entity Create();
+
+    template <typename Component, typename... Args>
+    Entity Create(Args&&... args)
+    {
+        Entity newEntity{ Create() };
+        Emplace<Component>(newEntity, std::forward<Args>(args)...);
+
+        return newEntity;
+    }
+
+    void Destroy(const Entity entity);
+    void Clear();
+
+    template <typename Component, typename... Args>
+    decltype(auto) Emplace(const Entity entity, Args&&... args)
+    {
+        if (!m_entities.IsValid(entity))
+            Insert(entity);
+
+        const ComponentInfo& info{ ComponentInfo::Of<Component>() };
+        EntityLocation& location{ m_locations[entityIndex(entity)] };
+
+        assert(!location.archetype->Has(info.family) && "Component exists");
+
+        Archetype* source{ location.archetype };
+        Archetype* destination{ AddEdge(*source, info) };
+
+        const std::size_t row{ destination->Allocate(entity) };
+
+        // Constructed first, the arguments may refer to the entity's other
+        // components which are moved from right after.
+        Component* component{ std::construct_at(
+            static_cast<Component*>(
+                destination->At(destination->Column(info.family), row)),
+            std::forward<Args>(args)...) };
+
+        source->MoveTo(location.row, *destination, row);
+        RemoveRow(*source, location.row);
+        location = { .archetype = destination, .row = row };
+
+        return *component;
+    }
+
+    template <typename Component>
+    decltype(auto) Patch(
+        const Entity entity,
+        std::function<void(Component&)>&& func)
+    {
+        auto& component{ Get<Component>(entity) };
+        (func)(component);
+        return component;
+    }
+
+    template <typename... Components>
+    void Erase(const Entity entity)
+    {
+        static_assert(sizeof...(Components) > 0);
+        if constexpr (sizeof...(Components) == 1u)
+        {
+            Erase(entity, FamilyId::Type<Components...>());
+        }
+        else
+        {
+            (Erase<Components>(entity), ...);
+        }
+    }
+
+    template <typename... Components>
+    [[nodiscard]] decltype(auto) Get(const Entity entity)
+    {
+        static_assert(sizeof...(Components) > 0);
+        if constexpr (sizeof...(Components) == 1u)
+        {
+            return (GetComponent<Components>(entity), ...);
+        }
+        else
+        {
+            return std::forward_as_tuple(GetComponent<Components>(entity)...);
+        }
+    }
+
+    template <typename... Components>
+    decltype(auto) QueryAll()
+    {
+        static_assert(sizeof...(Components) > 0);
+        return ArchetypeQuery<Components...>(m_archetypes);
+    }
+
+    template <typename... Components>
+    bool AnyOf(const Entity entity)
+    {
+        return (AllOf<Components>(entity) || ...);
+    }
+
+    template <typename... Components>
+    bool AllOf(const Entity entity)
+    {
+        static_assert(sizeof...(Components) > 0);
+        return IsValid(entity) &&
+               (m_locations[entityIndex(entity)].archetype->Has(
+                    FamilyId::Type<Components>()) &&
+                ...);
+    }
+
+    bool IsValid(const Entity entity) const;
+
+    std::size_t ArchetypeCount() const;
+
+private:
+    struct EntityLocation
+    {
+        Archetype* archetype;
+        std::size_t row;
+    };
+
+    template <typename Component>
+    Component& GetComponent(const Entity entity)
+    {
+        assert(IsValid(entity) && "Invalid entity");
+
+        const EntityLocation& location{ m_locations[entityIndex(entity)] };
+        const std::size_t column{ location.archetype->Column(
+            FamilyId::Type<Component>()) };
+
+        assert(column != Archetype::INVALID_COLUMN && "Missing component");
+
+        return *static_cast<Component*>(
+            location.archetype->At(column, location.row));
+    }
+
+    // Registers a handle the registry never issued, stale handles of
+    // destroyed entities are rejected.
+    void Insert(const Entity entity);
+    void Place(const Entity entity);
+    void Erase(const Entity entity, Family family);
+    void RemoveRow(Archetype& archetype, std::size_t row);
+
+    Archetype* AddEdge(Archetype& source, const ComponentInfo& info);
+    Archetype* RemoveEdge(Archetype& source, Family family);
+    Archetype* FindOrCreate(std::vector<const ComponentInfo*>&& components);
+
+private:
+    std::vector<std::unique_ptr<Archetype>> m_archetypes;
+    std::vector<EntityLocation> m_locations;
+    EntityPool m_entities;
+};
+}
@@ -0,0 +1,190 @@
+#include "CommandBuffer.hpp"
+
+#include "Entity.hpp"
+#include "Registry.hpp"
+#include "core/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Zeus::ECS
+{
+CommandBuffer::CommandBuffer()
+    : m_streams(JobSystem::ThreadCount() + 1u),
+      m_created{},
+      m_provisional{ 0 },
+      m_owner{ std::this_thread::get_id() },
+      m_sharedMutex{}
+{
+}
+
+Entity CommandBuffer::Create()
+{
+    const Entity index{ m_provisional.fetch_add(1, std::memory_order_relaxed) };
+
+    assert(index <= ENTITY_INDEX_MASK && "Out of provisional entities");
+
+    return makeEntity(index, ENTITY_PROVISIONAL_VERSION);
+}
+
+void CommandBuffer::Destroy(const Entity entity)
+{
+    Record([entity](Stream& stream) {
+        stream.commands.push_back({
+            .entity = entity,
+            .family = 0,
+            .value = 0,
+            .type = CommandType::Destroy,
+        });
+    });
+}
+
+void CommandBuffer::Playback(Registry& registry)
+{
+    // Provisional indices are handed out in order, so are the real entities.
+    const Entity created{ m_provisional.exchange(
+        0,
+        std::memory_order_relaxed) };
+
+    m_created.resize(created);
+    for (Entity& entity : m_created)
+    {
+        entity = registry.Create();
+    }
+
+    struct Pending
+    {
+        Entity entity;
+        const Command* command;
+        ComponentCommandsBase* components;
+    };
+
+    std::vector<Pending> pending{};
+    std::vector<std::size_t> emplaced{};
+    std::vector<ComponentCommandsBase*> families{};
+
+    for (Stream& stream : m_streams)
+    {
+        for (const Command& command : stream.commands)
+        {
+            ComponentCommandsBase* components{
+                command.type != CommandType::Destroy
+                    ? stream.components[command.family].get()
+                    : nullptr
+            };
+
+            pending.push_back({
+                .entity = Resolve(command.entity),
+                .command = &command,
+                .components = components,
+            });
+        }
+
+        if (stream.components.size() > families.size())
+        {
+            families.resize(stream.components.size(), nullptr);
+            emplaced.resize(stream.components.size(), 0);
+        }
+
+        for (std::size_t family{ 0 }; family < stream.components.size();
+             ++family)
+        {
+            if (ComponentCommandsBase* components{
+                    stream.components[family].get() })
+            {
+                families[family] = components;
+                emplaced[family] += components->Size();
+            }
+        }
+    }
+
+    for (std::size_t family{ 0 }; family < families.size(); ++family)
+    {
+        if (emplaced[family] > 0)
+            families[family]->Reserve(registry, emplaced[family]);
+    }
+
+    // Sorting by entity keeps the pool accesses close, the stable sort
+    // keeps the recorded order of each entity's commands.
+    std::stable_sort(
+        pending.begin(),
+        pending.end(),
+        [](const Pending& lhs, const Pending& rhs) {
+            return entityIndex(lhs.entity) < entityIndex(rhs.entity);
+        });
+
+    for (const Pending& command : pending)
+    {
+        if (!registry.IsValid(command.entity))
+            continue;
+
+        switch (command.command->type)
+        {
+        case CommandType::Emplace:
+            command.components->PlayEmplace(
+                registry,
+                command.entity,
+                command.command->value);
+            break;
+        case CommandType::Erase:
+            command.components->PlayErase(registry, command.entity);
+            break;
+        case CommandType::Destroy:
+            registry.Destroy(command.entity);
+            break;
+        }
+    }
+
+    for (Stream& stream : m_streams)
+    {
+        stream.commands.clear();
+
+        for (const auto& components : stream.components)
+        {
+            if (components != nullptr)
+                components->Clear();
+        }
+    }
+}
+
+bool CommandBuffer::Empty() const
+{
+    if (m_provisional.load(std::memory_order_relaxed) > 0)
+        return false;
+
+    return std::all_of(
+        m_streams.begin(),
+        m_streams.end(),
+        [](const Stream& stream) { return stream.commands.empty(); });
+}
+
+Entity CommandBuffer::Resolve(const Entity entity) const
+{
+    if (entityVersion(entity) != ENTITY_PROVISIONAL_VERSION)
+        return entity;
+
+    assert(entityIndex(entity) < m_created.size() && "Not played back");
+
+    return m_created[entityIndex(entity)];
+}
+
+CommandBuffer::Stream* CommandBuffer::OwnStream()
+{
+    const std::uint32_t thread{ JobSystem::ThreadIndex() };
+
+    assert(
+        thread + 1u < m_streams.size() && "Buffer created before job system");
+
+    // Every thread outside the job system reports the first index.
+    if (thread == 0 && std::this_thread::get_id() != m_owner)
+        return nullptr;
+
+    return &m_streams[thread];
+}
+}
@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+#include "Registry.hpp"
+#include "core/JobSystem.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Records structural changes to play them back later at a sync point, e.g.
+// while a query is iterating the pools. Every job system thread records into
+// its own stream so jobs can record concurrently without locking. Threads
+// outside the job system, except the one creating the buffer, share a
+// locked stream.
+//
+// Playback creates the recorded entities first, then applies the commands
+// sorted by entity. The commands of one entity keep the order they were
+// recorded in, streams follow each other in thread order. Emplacing a
+// component the entity already holds replaces it. Commands targeting an
+// entity destroyed in the meantime are skipped.
+class CommandBuffer
+{
+public:
+    // One stream per job system thread plus the shared one, create it after
+    // the job system.
+    CommandBuffer();
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    // Returns a provisional handle, only valid for commands of this buffer.
+    Entity Create();
+
+    void Destroy(const Entity entity);
+
+    // The component is constructed right away and moved into the registry
+    // during playback.
+    template <typename Component, typename... Args>
+    void Emplace(const Entity entity, Args&&... args)
+    {
+        Record([&](Stream& stream) {
+            auto& values{ Commands<Component>(stream).values };
+
+            stream.commands.push_back({
+                .entity = entity,
+                .family = FamilyId::Type<Component>(),
+                .value = static_cast<std::uint32_t>(values.size()),
+                .type = CommandType::Emplace,
+            });
+            values.emplace_back(std::forward<Args>(args)...);
+        });
+    }
+
+    template <typename... Components>
+    void Erase(const Entity entity)
+    {
+        static_assert(sizeof...(Components) > 0);
+
+        Record([entity, this](Stream& stream) {
+            (RecordErase<Components>(stream, entity), ...);
+        });
+    }
+
+    // Not thread safe, no command may be recorded during playback.
+    void Playback(Registry& registry);
+
+    bool Empty() const;
+
+    // Real entity of a provisional handle, valid after the last playback.
+    Entity Resolve(const Entity entity) const;
+
+private:
+    enum class CommandType : std::uint8_t
+    {
+        Emplace,
+        Erase,
+        Destroy,
+    };
+
+    struct Command
+    {
+        Entity entity;
+        Family family;
+        std::uint32_t value; // index of the emplaced value
+        CommandType type;
+    };
+
+    // Type erased access to the components recorded for one type.
+    struct ComponentCommandsBase
+    {
+        virtual ~ComponentCommandsBase() = default;
+
+        virtual std::size_t Size() const = 0;
+        virtual void Reserve(Registry& registry, std::size_t count) = 0;
+        virtual void PlayEmplace(
+            Registry& registry,
+            const Entity entity,
+            const std::uint32_t value) = 0;
+        virtual void PlayErase(Registry& registry, const Entity entity) = 0;
+        virtual void Clear() = 0;
+    };
+
+    template <typename Component>
+    struct ComponentCommands final : ComponentCommandsBase
+    {
+        std::vector<Component> values;
+
+        std::size_t Size() const override
+        {
+            return values.size();
+        }
+
+        void Reserve(Registry& registry, std::size_t count) override
+        {
+            registry.Reserve<Component>(count);
+        }
+
+        void PlayEmplace(
+            Registry& registry,
+            const Entity entity,
+            const std::uint32_t value) override
+        {
+            Component& component{ values[value] };
+
+            // Replaces a component the entity already holds.
+            if (registry.AllOf<Component>(entity))
+            {
+                registry.Patch<Component>(
+                    entity,
+                    [&component](Component& current) {
+                        current = std::move(component);
+                    });
+            }
+            else
+            {
+                registry.Emplace<Component>(entity, std::move(component));
+            }
+        }
+
+        void PlayErase(Registry& registry, const Entity entity) override
+        {
+            if (registry.AllOf<Component>(entity))
+                registry.Erase<Component>(entity);
+        }
+
+        void Clear() override
+        {
+            values.clear();
+        }
+    };
+
+    struct Stream
+    {
+        std::vector<Command> commands;
+        std::vector<std::unique_ptr<ComponentCommandsBase>> components;
+    };
+
+    // Stream of the calling thread, nullptr for threads sharing a stream.
+    Stream* OwnStream();
+
+    template <typename Func>
+    void Record(Func&& record)
+    {
+        if (Stream* stream{ OwnStream() })
+        {
+            record(*stream);
+            return;
+        }
+
+        std::lock_guard lock{ m_sharedMutex };
+        record(m_streams.back());
+    }
+
+    template <typename Component>
+    ComponentCommands<Component>& Commands(Stream& stream)
+    {
+        const Family family{ FamilyId::Type<Component>() };
+
+        if (family >= stream.components.size())
+            stream.components.resize(family + 1u);
+
+        if (stream.components[family] == nullptr)
+        {
+            stream.components[family] =
+                std::make_unique<ComponentCommands<Component>>();
+        }
+
+        return static_cast<ComponentCommands<Component>&>(
+            *stream.components[family]);
+    }
+
+    template <typename Component>
+    void RecordErase(Stream& stream, const Entity entity)
+    {
+        // Playback erases through the commands of the type.
+        Commands<Component>(stream);
+
+        stream.commands.push_back({
+            .entity = entity,
+            .family = FamilyId::Type<Component>(),
+            .value = 0,
+            .type = CommandType::Erase,
+        });
+    }
+
+private:
+    std::vector<Stream> m_streams;
+    std::vector<Entity> m_created;
+    std::atomic<Entity> m_provisional;
+    std::thread::id m_owner;
+    std::mutex m_sharedMutex;
+};
+}
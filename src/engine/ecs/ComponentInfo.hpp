@@ -0,0 +1,44 @@
+#pragma once
+
+#include "FamilyId.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Zeus::ECS
+{
+// Type-erased description of a component used by storages that keep
+// components of different types in raw memory (archetype chunks).
+struct ComponentInfo
+{
+    Family family;
+    std::size_t size;
+    std::size_t alignment;
+
+    void (*moveConstruct)(void* destination, void* source);
+    void (*destroy)(void* pointer);
+
+    template <typename Type>
+    static const ComponentInfo& Of() noexcept
+    {
+        static const ComponentInfo info{
+            .family = FamilyId::Type<Type>(),
+            .size = sizeof(Type),
+            .alignment = alignof(Type),
+            .moveConstruct =
+                [](void* destination, void* source) {
+                    std::construct_at(
+                        static_cast<Type*>(destination),
+                        std::move(*static_cast<Type*>(source)));
+                },
+            .destroy =
+                [](void* pointer) {
+                    std::destroy_at(static_cast<Type*>(pointer));
+                },
+        };
+
+        return info;
+    }
+};
+}
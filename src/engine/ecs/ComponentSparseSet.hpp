@@ -2,27 +2,70 @@
 
 #include "ComponentSparseSetIterator.hpp"
 #include "Entity.hpp"
+#include "Signal.hpp"
 #include "SparseSet.hpp"
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <memory_resource>
+#include <numeric>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Zeus::ECS
 {
+enum class SortMode : std::uint8_t
+{
+    // Sorts a permutation then applies it, for arbitrary input.
+    Full,
+    // Swaps neighbours in place, linear when the pool is nearly sorted.
+    Insertion,
+};
+
+// Every entry remembers the tick it was added and last changed at. Emplace,
+// Patch and GetMutable stamp the current tick of the bound tick source,
+// Get leaves the ticks untouched.
+// Empty types are tags, only membership is stored and Get returns a shared
+// instance.
+// OnConstruct is published once a component was added, OnUpdate after Patch
+// and OnDestroy before a component is removed. Listeners must not change
+// the pool that publishes.
 template <typename Type>
 class ComponentSparseSet : public SparseSet
 {
 private:
-    using Container = std::vector<Type>;
+    using Container = std::pmr::vector<Type>;
 
 public:
     using size_type = typename Container::size_type;
     using iterator = ComponentSparseSetIterator<Container>;
 
-    ComponentSparseSet(std::size_t maxEntity = 0)
-        : SparseSet(maxEntity),
-          m_components{}
+    static constexpr bool IS_TAG{ std::is_empty_v<Type> };
+
+    struct Removal
+    {
+        Entity entity;
+        std::uint32_t tick;
+    };
+
+    // Entities, components and ticks are allocated from the resource.
+    ComponentSparseSet(
+        std::size_t maxEntity = 0,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : SparseSet(0, resource),
+          m_components(resource),
+          m_ticks{ resource },
+          m_removed{},
+          m_trackRemovals{ false },
+          m_tick{ nullptr },
+          m_onConstruct{},
+          m_onUpdate{},
+          m_onDestroy{}
     {
         if (maxEntity > 0)
             Reserve(maxEntity);
@@ -30,7 +73,14 @@ public:
 
     ComponentSparseSet(ComponentSparseSet&& other) noexcept
         : SparseSet(static_cast<SparseSet&&>(other)),
-          m_components{ std::move(other.m_components) }
+          m_components{ std::move(other.m_components) },
+          m_ticks{ std::move(other.m_ticks) },
+          m_removed{ std::move(other.m_removed) },
+          m_trackRemovals{ other.m_trackRemovals },
+          m_tick{ other.m_tick },
+          m_onConstruct{ std::move(other.m_onConstruct) },
+          m_onUpdate{ std::move(other.m_onUpdate) },
+          m_onDestroy{ std::move(other.m_onDestroy) }
     {
     }
 
@@ -40,6 +90,13 @@ public:
         {
             static_cast<SparseSet&>(*this) = std::move(other);
             m_components = std::move(other.m_components);
+            m_ticks = std::move(other.m_ticks);
+            m_removed = std::move(other.m_removed);
+            m_trackRemovals = other.m_trackRemovals;
+            m_tick = other.m_tick;
+            m_onConstruct = std::move(other.m_onConstruct);
+            m_onUpdate = std::move(other.m_onUpdate);
+            m_onDestroy = std::move(other.m_onDestroy);
         }
 
         return *this;
@@ -48,61 +105,418 @@ public:
     void Push(const Entity entity) override
     {
         SparseSet::Push(entity);
-        m_components.push_back({});
+
+        if constexpr (!IS_TAG)
+            m_components.push_back({});
+
+        m_ticks.push_back({ .added = CurrentTick(), .changed = CurrentTick() });
+        m_onConstruct.Publish(entity);
     }
 
     void Pop(const Entity entity) override
     {
+        m_onDestroy.Publish(entity);
+
         auto index{ Index(entity) };
         SparseSet::Pop(entity);
 
-        std::swap(m_components[index], m_components[m_components.size() - 1]);
-        m_components.pop_back();
+        if constexpr (!IS_TAG)
+        {
+            std::swap(
+                m_components[index],
+                m_components[m_components.size() - 1]);
+            m_components.pop_back();
+        }
+
+        m_ticks[index] = m_ticks.back();
+        m_ticks.pop_back();
+
+        if (m_trackRemovals)
+            m_removed.push_back({ .entity = entity, .tick = CurrentTick() });
+    }
+
+    // Pops without a virtual call per entity.
+    void PopMany(const Entity* first, const Entity* last) override
+    {
+        for (; first != last; ++first)
+        {
+            if (Contains(*first))
+                ComponentSparseSet::Pop(*first);
+        }
+    }
+
+    bool IsCloneable() const override
+    {
+        return IS_TAG || std::is_copy_constructible_v<Type>;
+    }
+
+    // The component is copied once per entity, a fill which reduces to block
+    // copies for trivially copyable types.
+    void CloneMany(
+        const Entity source,
+        const Entity* first,
+        const Entity* last) override
+    {
+        if constexpr (IS_TAG)
+        {
+            (void)source;
+
+            const std::size_t constructed{ Size() };
+            Append(first, last);
+            PublishConstructed(constructed);
+        }
+        else if constexpr (std::is_copy_constructible_v<Type>)
+        {
+            // Copied first, growing the pool would invalidate it.
+            const Type component{ Get(source) };
+            EmplaceMany(first, last, component);
+        }
+        else
+        {
+            // The registry checks IsCloneable before cloning.
+            assert(false && "Component is not copyable");
+        }
+    }
+
+    // Replaces the content, components are default constructed and stamped
+    // with the current tick. Used to bulk load pools, OnConstruct is not
+    // published until PublishAssigned once the components are filled in.
+    void Assign(std::vector<Entity>&& entities)
+    {
+        SparseSet::Assign(std::move(entities));
+
+        if constexpr (!IS_TAG)
+        {
+            m_components.clear();
+            m_components.resize(Size());
+        }
+
+        m_ticks.assign(
+            Size(),
+            { .added = CurrentTick(), .changed = CurrentTick() });
+    }
+
+    void PublishAssigned()
+    {
+        PublishConstructed(0);
+    }
+
+    // Reorders entities and components together so iterating the pool
+    // follows compare(lhs, rhs) on components. Ticks are kept.
+    template <typename Compare>
+    void Sort(Compare compare, SortMode mode = SortMode::Full)
+        requires(!IS_TAG)
+    {
+        if (mode == SortMode::Insertion)
+        {
+            for (std::size_t i{ 1 }; i < Size(); ++i)
+            {
+                for (std::size_t j{ i };
+                     j > 0 && compare(m_components[j], m_components[j - 1]);
+                     --j)
+                {
+                    ComponentSparseSet::Swap(j, j - 1);
+                }
+            }
+
+            return;
+        }
+
+        std::vector<std::size_t> order(Size());
+        std::iota(order.begin(), order.end(), std::size_t{ 0 });
+        std::sort(
+            order.begin(),
+            order.end(),
+            [this, &compare](std::size_t lhs, std::size_t rhs) {
+                return compare(m_components[lhs], m_components[rhs]);
+            });
+
+        // Position i receives the entry at order[i], one cycle at a time.
+        for (std::size_t i{ 0 }; i < order.size(); ++i)
+        {
+            std::size_t current{ i };
+            while (order[current] != i)
+            {
+                const std::size_t next{ order[current] };
+                ComponentSparseSet::Swap(current, next);
+                order[current] = current;
+                current = next;
+            }
+
+            order[current] = current;
+        }
+    }
+
+    void Swap(std::size_t lhs, std::size_t rhs) override
+    {
+        SparseSet::Swap(lhs, rhs);
+
+        if constexpr (!IS_TAG)
+            std::swap(m_components[lhs], m_components[rhs]);
+
+        std::swap(m_ticks[lhs], m_ticks[rhs]);
     }
 
     template <typename... Args>
     decltype(auto) Emplace(const Entity entity, Args&&... args)
     {
         SparseSet::Push(entity);
-        return m_components.emplace_back(std::forward<Args>(args)...);
+        m_ticks.push_back({ .added = CurrentTick(), .changed = CurrentTick() });
+
+        if constexpr (IS_TAG)
+        {
+            ((void)args, ...);
+            m_onConstruct.Publish(entity);
+
+            return Tag();
+        }
+        else
+        {
+            auto& component{
+                m_components.emplace_back(std::forward<Args>(args)...)
+            };
+            m_onConstruct.Publish(entity);
+
+            return component;
+        }
+    }
+
+    // Appends the entities with a copy of the value each. The dense arrays
+    // grow once and are written in a single pass.
+    template <std::forward_iterator It>
+    void EmplaceMany(It first, It last, const Type& value = {})
+    {
+        const std::size_t constructed{ Size() };
+        const auto count{ Append(first, last) };
+
+        if constexpr (!IS_TAG)
+            m_components.insert(m_components.end(), count, value);
+
+        PublishConstructed(constructed);
+    }
+
+    // Appends the entities with the components read from values, one per
+    // entity.
+    template <std::forward_iterator It, std::input_iterator ValueIt>
+    void EmplaceMany(It first, It last, ValueIt values)
+    {
+        const std::size_t constructed{ Size() };
+        const auto count{ Append(first, last) };
+
+        if constexpr (!IS_TAG)
+        {
+            for (std::size_t i{ 0 }; i < count; ++i, ++values)
+                m_components.emplace_back(*values);
+        }
+
+        PublishConstructed(constructed);
     }
 
     decltype(auto) Patch(const Entity entity, std::function<void(Type&)>&& func)
     {
-        auto& elem{ Get(entity) };
+        auto& elem{ GetMutable(entity) };
         (func)(elem);
+        m_onUpdate.Publish(entity);
         return elem;
     }
 
     decltype(auto) Get(const Entity entity)
     {
         const auto index{ Index(entity) };
-        return m_components[index];
+
+        if constexpr (IS_TAG)
+            return ((void)index, Tag());
+        else
+            return m_components[index];
+    }
+
+    // Get which marks the component as changed.
+    decltype(auto) GetMutable(const Entity entity)
+    {
+        const auto index{ Index(entity) };
+        m_ticks[index].changed = CurrentTick();
+
+        if constexpr (IS_TAG)
+            return Tag();
+        else
+            return m_components[index];
+    }
+
+    std::uint32_t AddedTick(const Entity entity) const
+    {
+        return m_ticks[Index(entity)].added;
+    }
+
+    std::uint32_t ChangedTick(const Entity entity) const
+    {
+        return m_ticks[Index(entity)].changed;
+    }
+
+    // Ticks are read from the source, the registry binds its tick counter.
+    // Unbound pools stamp tick zero.
+    void BindTick(const std::uint32_t* tick)
+    {
+        m_tick = tick;
+    }
+
+    std::uint32_t CurrentTick() const
+    {
+        return m_tick != nullptr ? *m_tick : 0u;
+    }
+
+    // Removals are only recorded once tracking is enabled, pools nobody
+    // watches keep none.
+    void TrackRemovals()
+    {
+        m_trackRemovals = true;
+    }
+
+    // Entities removed from the pool since tracking started, oldest first.
+    const std::vector<Removal>& Removed() const
+    {
+        return m_removed;
+    }
+
+    // Forgets removals stamped at or before the tick.
+    void TrimRemoved(std::uint32_t tick)
+    {
+        std::erase_if(m_removed, [tick](const Removal& removal) {
+            return removal.tick <= tick;
+        });
+    }
+
+    void Clear() override
+    {
+        for (std::size_t i{ 0 }; i < Size(); ++i)
+        {
+            m_onDestroy.Publish(Data()[i]);
+
+            if (m_trackRemovals)
+            {
+                m_removed.push_back(
+                    { .entity = Data()[i], .tick = CurrentTick() });
+            }
+        }
+
+        SparseSet::Clear();
+
+        if constexpr (!IS_TAG)
+            m_components.clear();
+
+        m_ticks.clear();
     }
 
     void Reserve(std::size_t capacity) override
     {
         SparseSet::Reserve(capacity);
-        m_components.reserve(capacity);
+
+        if constexpr (!IS_TAG)
+            m_components.reserve(capacity);
+
+        m_ticks.reserve(capacity);
+    }
+
+    Signal<Entity>& OnConstruct()
+    {
+        return m_onConstruct;
     }
 
-    const Type* Componenets() const
+    Signal<Entity>& OnUpdate()
+    {
+        return m_onUpdate;
+    }
+
+    Signal<Entity>& OnDestroy()
+    {
+        return m_onDestroy;
+    }
+
+    Type* Components()
+        requires(!IS_TAG)
+    {
+        return m_components.data();
+    }
+
+    const Type* Components() const
+        requires(!IS_TAG)
     {
         return m_components.data();
     }
 
     static_assert(std::random_access_iterator<iterator>);
     [[nodiscard]] iterator begin() const noexcept
+        requires(!IS_TAG)
     {
         return iterator(m_components, 0);
     }
 
     [[nodiscard]] iterator end() const noexcept
+        requires(!IS_TAG)
     {
         return iterator(m_components, m_components.size());
     }
 
 private:
-    Container m_components;
+    struct Ticks
+    {
+        std::uint32_t added;
+        std::uint32_t changed;
+    };
+
+    struct NoComponents
+    {
+        explicit NoComponents(std::pmr::memory_resource*)
+        {
+        }
+    };
+
+    // Pushes the entities and their ticks, returns how many were pushed.
+    template <typename It>
+    std::size_t Append(It first, It last)
+    {
+        const auto count{
+            static_cast<std::size_t>(std::distance(first, last))
+        };
+
+        if (Size() + count > Capacity())
+            Reserve(Size() + count);
+
+        for (; first != last; ++first)
+            SparseSet::Push(*first);
+
+        m_ticks.insert(
+            m_ticks.end(),
+            count,
+            { .added = CurrentTick(), .changed = CurrentTick() });
+
+        return count;
+    }
+
+    // Publishes OnConstruct for the entities from position first on.
+    void PublishConstructed(std::size_t first)
+    {
+        if (m_onConstruct.Empty())
+            return;
+
+        for (std::size_t i{ first }; i < Size(); ++i)
+            m_onConstruct.Publish(Data()[i]);
+    }
+
+    static Type& Tag()
+    {
+        static Type tag{};
+        return tag;
+    }
+
+    [[no_unique_address]] std::conditional_t<IS_TAG, NoComponents, Container>
+        m_components;
+    std::pmr::vector<Ticks> m_ticks;
+    std::vector<Removal> m_removed;
+    bool m_trackRemovals;
+    const std::uint32_t* m_tick;
+
+    Signal<Entity> m_onConstruct;
+    Signal<Entity> m_onUpdate;
+    Signal<Entity> m_onDestroy;
 };
 }
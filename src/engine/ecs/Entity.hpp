@@ -4,5 +4,43 @@
 
 namespace Zeus::ECS
 {
+// Packs an index (low bits) and a version (high bits). The index addresses
+// sparse arrays and is recycled, the version tells stale handles apart.
 using Entity = std::uint32_t;
+
+inline constexpr Entity ENTITY_INDEX_BITS{ 22 };
+inline constexpr Entity ENTITY_INDEX_MASK{ (1u << ENTITY_INDEX_BITS) - 1u };
+inline constexpr Entity ENTITY_VERSION_MASK{ ~Entity{ 0 } >>
+                                             ENTITY_INDEX_BITS };
+
+// Reserved for handles that do not exist yet, e.g. entities created through a
+// command buffer before playback. The registry never hands it out.
+inline constexpr Entity ENTITY_PROVISIONAL_VERSION{ ENTITY_VERSION_MASK };
+
+constexpr Entity entityIndex(const Entity entity)
+{
+    return entity & ENTITY_INDEX_MASK;
+}
+
+constexpr Entity entityVersion(const Entity entity)
+{
+    return entity >> ENTITY_INDEX_BITS;
+}
+
+constexpr Entity makeEntity(const Entity index, const Entity version)
+{
+    return (index & ENTITY_INDEX_MASK) |
+           ((version & ENTITY_VERSION_MASK) << ENTITY_INDEX_BITS);
+}
+
+// Handle of the same index with the next version, wraps around before the
+// provisional version.
+constexpr Entity nextVersion(const Entity entity)
+{
+    const Entity version{ entityVersion(entity) + 1u };
+
+    return makeEntity(
+        entityIndex(entity),
+        version >= ENTITY_PROVISIONAL_VERSION ? 0u : version);
+}
 }
@@ -0,0 +1,142 @@
+#include "EntityPool.hpp"
+
+#include "Entity.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+EntityPool::EntityPool() : m_alive{}, m_released{}, m_next{ 0 }
+{
+}
+
+Entity EntityPool::Create()
+{
+    Entity entity;
+
+    if (m_released.empty())
+    {
+        assert(m_next <= ENTITY_INDEX_MASK && "Out of entity indices");
+        entity = m_next++;
+    }
+    else
+    {
+        entity = m_released.back();
+        m_released.pop_back();
+    }
+
+    m_alive.Push(entity);
+    return entity;
+}
+
+void EntityPool::Destroy(const Entity entity)
+{
+    assert(IsValid(entity) && "Invalid entity");
+
+    m_alive.Pop(entity);
+    m_released.push_back(nextVersion(entity));
+}
+
+void EntityPool::Insert(const Entity entity)
+{
+    assert(
+        entityVersion(entity) != ENTITY_PROVISIONAL_VERSION &&
+        "Provisional entity");
+
+    const Entity index{ entityIndex(entity) };
+
+    if (index >= m_next)
+    {
+        // Skipped indices become available to Create.
+        for (; m_next < index; ++m_next)
+            m_released.push_back(m_next);
+
+        ++m_next;
+    }
+    else
+    {
+        auto released{ std::find_if(
+            m_released.begin(),
+            m_released.end(),
+            [index](Entity other) { return entityIndex(other) == index; }) };
+
+        assert(released != m_released.end() && "Entity index is in use");
+
+        *released = m_released.back();
+        m_released.pop_back();
+    }
+
+    m_alive.Push(entity);
+}
+
+void EntityPool::Clear()
+{
+    for (const Entity entity : m_alive)
+    {
+        m_released.push_back(nextVersion(entity));
+    }
+
+    m_alive.Clear();
+}
+
+void EntityPool::Reserve(std::size_t capacity)
+{
+    if (capacity > m_alive.Capacity())
+        m_alive.Reserve(capacity);
+}
+
+void EntityPool::Assign(std::vector<Entity>&& alive)
+{
+    std::vector<bool> used{};
+    for (const Entity entity : alive)
+    {
+        const Entity index{ entityIndex(entity) };
+
+        if (index >= used.size())
+            used.resize(index + 1u, false);
+
+        assert(!used[index] && "Entity index is in use");
+        used[index] = true;
+    }
+
+    m_alive.Assign(std::move(alive));
+    m_next = static_cast<Entity>(used.size());
+
+    // Highest first so Create hands out the lowest free index.
+    m_released.clear();
+    for (Entity index{ m_next }; index-- > 0;)
+    {
+        if (!used[index])
+            m_released.push_back(index);
+    }
+}
+
+bool EntityPool::IsValid(const Entity entity) const
+{
+    return m_alive.Contains(entity);
+}
+
+bool EntityPool::IsIssued(const Entity entity) const
+{
+    return entityIndex(entity) < m_next;
+}
+
+std::size_t EntityPool::Size() const
+{
+    return m_alive.Size();
+}
+
+std::size_t EntityPool::Released() const
+{
+    return m_released.size();
+}
+
+const SparseSet& EntityPool::Alive() const
+{
+    return m_alive;
+}
+}
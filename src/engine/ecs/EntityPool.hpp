@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "SparseSet.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Hands out entity handles and recycles indices of destroyed entities with
+// a bumped version, so sparse arrays stay bounded by the peak live count.
+class EntityPool
+{
+public:
+    EntityPool();
+
+    Entity Create();
+    void Destroy(const Entity entity);
+
+    // Registers a handle that was not created by the pool.
+    void Insert(const Entity entity);
+
+    void Clear();
+
+    // Makes room for capacity alive entities.
+    void Reserve(std::size_t capacity);
+
+    // Replaces the pool with the alive entities, every other index below the
+    // highest one becomes available to Create.
+    void Assign(std::vector<Entity>&& alive);
+
+    bool IsValid(const Entity entity) const;
+    // Whether the index was handed out before, a handle of an issued index
+    // that is not valid is stale.
+    bool IsIssued(const Entity entity) const;
+    std::size_t Size() const;
+    std::size_t Released() const;
+
+    const SparseSet& Alive() const;
+
+private:
+    SparseSet m_alive;
+    std::vector<Entity> m_released;
+    Entity m_next;
+};
+}
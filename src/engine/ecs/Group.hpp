@@ -0,0 +1,102 @@
+#pragma once
+
+#include "core/JobSystem.hpp"
+#include "ecs/ComponentSparseSet.hpp"
+#include "ecs/Entity.hpp"
+#include "ecs/GroupHandler.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace Zeus::ECS
+{
+// View over an owning group. The owned pools share their first Size()
+// entries, so iteration walks the component arrays in lockstep without any
+// membership checks.
+template <typename... Owned>
+class Group
+{
+    static_assert(
+        !(ComponentSparseSet<Owned>::IS_TAG || ...),
+        "Tags have no storage to pack");
+
+public:
+    Group(GroupHandler& handler, ComponentSparseSet<Owned>*... pools)
+        : m_handler{ &handler },
+          m_pools{ pools... }
+    {
+    }
+
+    template <typename Func>
+    void Each(Func&& function)
+    {
+        Each(0, Size(), function);
+    }
+
+    // Visits group entries [first, last).
+    template <typename Func>
+    void Each(std::size_t first, std::size_t last, Func&& function)
+    {
+        Each(function, first, last, std::index_sequence_for<Owned...>{});
+    }
+
+    // The function is called concurrently and has to be thread safe.
+    template <typename Func>
+    void ParallelEach(
+        Func&& function,
+        std::uint32_t batchSize = JobSystem::DEFAULT_BATCH_SIZE)
+    {
+        JobSystem::ParallelFor(
+            static_cast<std::uint32_t>(Size()),
+            batchSize,
+            [this, &function](std::uint32_t first, std::uint32_t last) {
+                Each(first, last, function);
+            });
+    }
+
+    bool Contains(const Entity entity) const
+    {
+        return m_handler->Contains(entity);
+    }
+
+    std::size_t Size() const
+    {
+        return m_handler->Size();
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    // Entities of the group, in iteration order.
+    const Entity* Entities() const
+    {
+        return std::get<0>(m_pools)->Data();
+    }
+
+private:
+    template <typename Func, std::size_t... Index>
+    void Each(
+        Func& function,
+        std::size_t first,
+        std::size_t last,
+        std::index_sequence<Index...>)
+    {
+        std::tuple<Owned*...> components{
+            std::get<Index>(m_pools)->Components()...
+        };
+
+        for (std::size_t i{ first }; i < last; ++i)
+        {
+            function(std::get<Index>(components)[i]...);
+        }
+    }
+
+private:
+    GroupHandler* m_handler;
+    std::tuple<ComponentSparseSet<Owned>*...> m_pools;
+};
+}
@@ -0,0 +1,97 @@
+#include "GroupHandler.hpp"
+
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+#include "SparseSet.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+GroupHandler::GroupHandler(
+    std::vector<Family>&& families,
+    std::vector<SparseSet*>&& pools)
+    : m_families{ std::move(families) },
+      m_pools{ std::move(pools) },
+      m_size{ 0 }
+{
+    assert(m_families.size() == m_pools.size() && "Pool count mismatch");
+    assert(!m_pools.empty() && "Group without pools");
+
+    Refresh();
+}
+
+void GroupHandler::OnEmplace(const Entity entity)
+{
+    if (!AllOf(entity) || m_pools.front()->Index(entity) < m_size)
+        return;
+
+    for (SparseSet* pool : m_pools)
+    {
+        pool->Swap(pool->Index(entity), m_size);
+    }
+
+    ++m_size;
+}
+
+void GroupHandler::OnErase(const Entity entity)
+{
+    if (!Contains(entity))
+        return;
+
+    --m_size;
+
+    // Moving the entity past the group keeps the prefix packed, the pools
+    // are free to swap-and-pop it afterwards.
+    for (SparseSet* pool : m_pools)
+    {
+        pool->Swap(pool->Index(entity), m_size);
+    }
+}
+
+void GroupHandler::Clear()
+{
+    m_size = 0;
+}
+
+void GroupHandler::Refresh()
+{
+    m_size = 0;
+
+    // Pack the entities that already have every owned component.
+    const SparseSet& pool{ *m_pools.front() };
+    for (std::size_t i{ 0 }; i < pool.Size(); ++i)
+    {
+        OnEmplace(pool.Data()[i]);
+    }
+}
+
+bool GroupHandler::Contains(const Entity entity) const
+{
+    // Every entity in the prefix of the first pool is part of the group.
+    return m_pools.front()->Contains(entity) &&
+           m_pools.front()->Index(entity) < m_size;
+}
+
+std::size_t GroupHandler::Size() const
+{
+    return m_size;
+}
+
+const std::vector<Family>& GroupHandler::Families() const
+{
+    return m_families;
+}
+
+bool GroupHandler::AllOf(const Entity entity) const
+{
+    return std::all_of(
+        m_pools.begin(),
+        m_pools.end(),
+        [entity](const SparseSet* pool) { return pool->Contains(entity); });
+}
+}
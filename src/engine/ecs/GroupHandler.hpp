@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+#include "SparseSet.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Keeps the entities having every owned component packed at the front of
+// the owned pools, in the same order. Entries [0, Size()) of each pool refer
+// to the same entities so a group is iterated in lockstep.
+// The registry notifies the handler around every change of an owned pool.
+class GroupHandler
+{
+public:
+    // Families and pools have to be sorted by family.
+    GroupHandler(
+        std::vector<Family>&& families,
+        std::vector<SparseSet*>&& pools);
+
+    GroupHandler(const GroupHandler&) = delete;
+    GroupHandler& operator=(const GroupHandler&) = delete;
+
+    // Called once the entity has been added to one of the owned pools.
+    void OnEmplace(const Entity entity);
+
+    // Called before the entity is removed from one of the owned pools.
+    void OnErase(const Entity entity);
+
+    // Resets the group's length, the owned pools are left untouched.
+    void Clear();
+
+    // Packs the owned pools again, after they were filled without
+    // notifications.
+    void Refresh();
+
+    bool Contains(const Entity entity) const;
+    std::size_t Size() const;
+
+    const std::vector<Family>& Families() const;
+
+private:
+    bool AllOf(const Entity entity) const;
+
+private:
+    std::vector<Family> m_families;
+    std::vector<SparseSet*> m_pools;
+    std::size_t m_size;
+};
+}
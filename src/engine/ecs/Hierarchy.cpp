@@ -0,0 +1,314 @@
+#include "Hierarchy.hpp"
+
+#include "Entity.hpp"
+#include "core/JobSystem.hpp"
+#include "math/definitions.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zeus::ECS
+{
+void Hierarchy::Insert(
+    const Entity entity,
+    const Entity parent,
+    const Math::Matrix4x4f& local)
+{
+    assert(!Contains(entity) && "Entity is in the hierarchy");
+
+    const auto last{ static_cast<std::uint32_t>(m_entities.size()) };
+
+    m_entities.push_back(entity);
+    m_parents.push_back(NO_POSITION);
+    m_sizes.push_back(1);
+    m_locals.push_back(local);
+    m_worlds.push_back(local);
+    m_states.push_back(CLEAN);
+
+    const Entity index{ entityIndex(entity) };
+    if (index >= m_positions.size())
+        m_positions.resize(index + 1u, NO_POSITION);
+
+    m_positions[index] = last;
+
+    std::uint32_t position{ last };
+    if (parent != NO_PARENT)
+    {
+        const std::uint32_t parentPosition{ Position(parent) };
+        position = parentPosition + m_sizes[parentPosition];
+
+        if (position != last)
+            Move(last, 1, position);
+
+        m_parents[position] = parentPosition;
+        AddToAncestors(parentPosition, 1);
+    }
+
+    MarkDirty(position);
+}
+
+void Hierarchy::Remove(const Entity entity)
+{
+    const std::uint32_t position{ Position(entity) };
+    const std::uint32_t count{ m_sizes[position] };
+    const auto size{ static_cast<std::uint32_t>(m_entities.size()) };
+
+    AddToAncestors(m_parents[position], -std::int64_t{ count });
+
+    if (position + count != size)
+        Move(position, count, size);
+
+    for (std::uint32_t i{ size - count }; i < size; ++i)
+    {
+        m_positions[entityIndex(m_entities[i])] = NO_POSITION;
+    }
+
+    Resize(size - count);
+}
+
+void Hierarchy::SetParent(const Entity entity, const Entity parent)
+{
+    const std::uint32_t position{ Position(entity) };
+    const std::uint32_t count{ m_sizes[position] };
+
+    std::uint32_t target{ static_cast<std::uint32_t>(m_entities.size()) };
+    if (parent != NO_PARENT)
+    {
+        const std::uint32_t parentPosition{ Position(parent) };
+
+        assert(
+            (parentPosition < position || parentPosition >= position + count) &&
+            "Parent is a descendant of the entity");
+
+        target = parentPosition + m_sizes[parentPosition];
+    }
+
+    AddToAncestors(m_parents[position], -std::int64_t{ count });
+
+    std::uint32_t moved{ position };
+    if (target < position)
+    {
+        Move(position, count, target);
+        moved = target;
+    }
+    else if (target > position + count)
+    {
+        Move(position, count, target);
+        moved = target - count;
+    }
+
+    const std::uint32_t parentPosition{ parent != NO_PARENT ? Position(parent)
+                                                             : NO_POSITION };
+
+    m_parents[moved] = parentPosition;
+    AddToAncestors(parentPosition, count);
+
+    // The whole subtree needs new world matrices.
+    MarkDirty(moved);
+}
+
+void Hierarchy::SetLocal(const Entity entity, const Math::Matrix4x4f& local)
+{
+    const std::uint32_t position{ Position(entity) };
+
+    m_locals[position] = local;
+    MarkDirty(position);
+}
+
+void Hierarchy::Propagate(std::uint32_t batchSize)
+{
+    m_roots.clear();
+    for (std::uint32_t root{ 0 }; root < m_entities.size();
+         root += m_sizes[root])
+    {
+        if (m_states[root] != CLEAN)
+            m_roots.push_back(root);
+    }
+
+    // Subtrees of different roots do not overlap, neither do their writes.
+    JobSystem::ParallelFor(
+        static_cast<std::uint32_t>(m_roots.size()),
+        batchSize,
+        [this](std::uint32_t first, std::uint32_t last) {
+            for (std::uint32_t i{ first }; i < last; ++i)
+            {
+                PropagateSubtree(m_roots[i]);
+            }
+        });
+}
+
+const Math::Matrix4x4f& Hierarchy::Local(const Entity entity) const
+{
+    return m_locals[Position(entity)];
+}
+
+const Math::Matrix4x4f& Hierarchy::World(const Entity entity) const
+{
+    return m_worlds[Position(entity)];
+}
+
+Entity Hierarchy::Parent(const Entity entity) const
+{
+    const std::uint32_t parent{ m_parents[Position(entity)] };
+
+    return parent != NO_POSITION ? m_entities[parent] : NO_PARENT;
+}
+
+std::size_t Hierarchy::SubtreeSize(const Entity entity) const
+{
+    return m_sizes[Position(entity)];
+}
+
+bool Hierarchy::Contains(const Entity entity) const
+{
+    const Entity index{ entityIndex(entity) };
+
+    return index < m_positions.size() &&
+           m_positions[index] != NO_POSITION &&
+           m_entities[m_positions[index]] == entity;
+}
+
+std::size_t Hierarchy::Size() const
+{
+    return m_entities.size();
+}
+
+void Hierarchy::Clear()
+{
+    Resize(0);
+    m_positions.clear();
+}
+
+const Entity* Hierarchy::Data() const
+{
+    return m_entities.data();
+}
+
+std::uint32_t Hierarchy::Position(const Entity entity) const
+{
+    assert(Contains(entity) && "Entity is not in the hierarchy");
+
+    return m_positions[entityIndex(entity)];
+}
+
+void Hierarchy::Move(
+    std::uint32_t first,
+    std::uint32_t count,
+    std::uint32_t position)
+{
+    // Rotating [low, high) moves the block and shifts the nodes it jumps
+    // over, everything outside keeps its position.
+    const std::uint32_t low{ std::min(first, position) };
+    const std::uint32_t high{ std::max(first + count, position) };
+    const std::uint32_t middle{ position < first ? first : first + count };
+
+    const auto rotate{ [low, middle, high](auto& array) {
+        std::rotate(
+            array.begin() + low,
+            array.begin() + middle,
+            array.begin() + high);
+    } };
+
+    rotate(m_entities);
+    rotate(m_parents);
+    rotate(m_sizes);
+    rotate(m_locals);
+    rotate(m_worlds);
+    rotate(m_states);
+
+    const auto remap{ [=](std::uint32_t old) {
+        if (old < low || old >= high)
+            return old;
+
+        if (old >= first && old < first + count)
+            return position < first ? old - (first - position)
+                                    : old + (position - count - first);
+
+        return position < first ? old + count : old - count;
+    } };
+
+    // Parents precede their children, only nodes past low can refer to a
+    // moved node.
+    for (std::size_t i{ low }; i < m_parents.size(); ++i)
+    {
+        if (m_parents[i] != NO_POSITION)
+            m_parents[i] = remap(m_parents[i]);
+    }
+
+    UpdatePositions(low, high);
+}
+
+void Hierarchy::Resize(std::size_t size)
+{
+    m_entities.resize(size);
+    m_parents.resize(size);
+    m_sizes.resize(size);
+    m_locals.resize(size);
+    m_worlds.resize(size);
+    m_states.resize(size);
+}
+
+void Hierarchy::UpdatePositions(std::uint32_t first, std::uint32_t last)
+{
+    for (std::uint32_t i{ first }; i < last; ++i)
+    {
+        m_positions[entityIndex(m_entities[i])] = i;
+    }
+}
+
+void Hierarchy::AddToAncestors(std::uint32_t parent, std::int64_t count)
+{
+    for (; parent != NO_POSITION; parent = m_parents[parent])
+    {
+        m_sizes[parent] = static_cast<std::uint32_t>(m_sizes[parent] + count);
+    }
+}
+
+void Hierarchy::MarkDirty(std::uint32_t position)
+{
+    m_states[position] |= DIRTY;
+
+    // An ancestor already flagged has its own ancestors flagged as well.
+    for (std::uint32_t parent{ m_parents[position] };
+         parent != NO_POSITION && !(m_states[parent] & DIRTY_DESCENDANT);
+         parent = m_parents[parent])
+    {
+        m_states[parent] |= DIRTY_DESCENDANT;
+    }
+}
+
+void Hierarchy::PropagateSubtree(std::uint32_t root)
+{
+    const std::uint32_t end{ root + m_sizes[root] };
+
+    for (std::uint32_t i{ root }; i < end;)
+    {
+        if (m_states[i] == CLEAN)
+        {
+            i += m_sizes[i];
+        }
+        else if (m_states[i] & DIRTY)
+        {
+            // Every node below a dirty one is recomputed, in a linear sweep.
+            const std::uint32_t last{ i + m_sizes[i] };
+            for (; i < last; ++i)
+            {
+                const std::uint32_t parent{ m_parents[i] };
+
+                m_worlds[i] = parent != NO_POSITION
+                                  ? m_worlds[parent] * m_locals[i]
+                                  : m_locals[i];
+                m_states[i] = CLEAN;
+            }
+        }
+        else
+        {
+            m_states[i] = CLEAN;
+            ++i;
+        }
+    }
+}
+}
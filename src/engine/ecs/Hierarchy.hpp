@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Entity.hpp"
+#include "core/JobSystem.hpp"
+#include "math/definitions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Parent/child relations with local and world transforms. Nodes are kept in
+// depth-first order in parallel arrays, a node is directly followed by its
+// descendants. World matrices are computed in a single linear pass where
+// parents always come before their children.
+// Changing a local transform marks the node dirty and its ancestors as having
+// a dirty descendant, Propagate skips subtrees without either. Independent
+// roots are propagated in parallel.
+class Hierarchy
+{
+public:
+    static constexpr Entity NO_PARENT{ ~Entity{ 0 } };
+    static constexpr std::uint32_t DEFAULT_ROOT_BATCH_SIZE{ 16 };
+
+    // The entity becomes the last child of the parent, or a root with
+    // NO_PARENT.
+    void Insert(
+        const Entity entity,
+        const Entity parent,
+        const Math::Matrix4x4f& local);
+
+    // Removes the entity along with its descendants.
+    void Remove(const Entity entity);
+
+    // Moves the entity and its descendants under the parent, or to the roots
+    // with NO_PARENT.
+    void SetParent(const Entity entity, const Entity parent);
+
+    void SetLocal(const Entity entity, const Math::Matrix4x4f& local);
+
+    // Brings the world matrices of dirty subtrees up to date.
+    void Propagate(std::uint32_t batchSize = DEFAULT_ROOT_BATCH_SIZE);
+
+    const Math::Matrix4x4f& Local(const Entity entity) const;
+
+    // Valid after Propagate.
+    const Math::Matrix4x4f& World(const Entity entity) const;
+
+    Entity Parent(const Entity entity) const;
+
+    // The entity itself included.
+    std::size_t SubtreeSize(const Entity entity) const;
+
+    bool Contains(const Entity entity) const;
+    std::size_t Size() const;
+    void Clear();
+
+    // Entities in depth-first order.
+    const Entity* Data() const;
+
+private:
+    static constexpr std::uint32_t NO_POSITION{ ~std::uint32_t{ 0 } };
+
+    enum State : std::uint8_t
+    {
+        CLEAN = 0,
+        DIRTY = 1 << 0,
+        DIRTY_DESCENDANT = 1 << 1,
+    };
+
+    std::uint32_t Position(const Entity entity) const;
+
+    // Moves [first, first + count) to position, which lies outside the range
+    // and is expressed before the move.
+    void Move(std::uint32_t first, std::uint32_t count, std::uint32_t position);
+
+    void Resize(std::size_t size);
+    void UpdatePositions(std::uint32_t first, std::uint32_t last);
+    void AddToAncestors(std::uint32_t parent, std::int64_t count);
+    void MarkDirty(std::uint32_t position);
+    void PropagateSubtree(std::uint32_t root);
+
+private:
+    std::vector<Entity> m_entities;
+    std::vector<std::uint32_t> m_parents;
+    std::vector<std::uint32_t> m_sizes;
+    std::vector<Math::Matrix4x4f> m_locals;
+    std::vector<Math::Matrix4x4f> m_worlds;
+    std::vector<std::uint8_t> m_states;
+
+    // Indexed by entity index, like the locations of ArchetypeRegistry.
+    std::vector<std::uint32_t> m_positions;
+    std::vector<std::uint32_t> m_roots;
+};
+}
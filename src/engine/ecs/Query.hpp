@@ -1,93 +1,193 @@
 #pragma once
 
+#include "core/JobSystem.hpp"
 #include "ecs/ComponentSparseSet.hpp"
 #include "ecs/Entity.hpp"
 #include "ecs/QueryIterator.hpp"
+#include "ecs/QueryParam.hpp"
 #include "ecs/SparseSet.hpp"
 
 #include <array>
 #include <cstddef>
-#include <functional>
+#include <cstdint>
+#include <tuple>
 #include <utility>
 
 namespace Zeus::ECS
 {
-template <typename... Components>
+// Iterates the smallest required pool and checks the other parameters per
+// entity. Parameters are components or filters, see QueryParam.
+template <typename... Params>
 class Query
 {
 public:
-    using iterator = QueryIterator<Components...>;
+    using iterator = QueryIterator<Query>;
 
-    constexpr Query(ComponentSparseSet<Components>*... pool)
+    struct Range
+    {
+        iterator first;
+        iterator last;
+
+        [[nodiscard]] iterator begin() const noexcept
+        {
+            return first;
+        }
+
+        [[nodiscard]] iterator end() const noexcept
+        {
+            return last;
+        }
+    };
+
+    constexpr Query(typename QueryParam<Params>::Pool*... pool)
         : m_pools{ pool... },
-          m_minIndex{ sizeof...(Components) }
+          m_required{},
+          m_driver{ nullptr },
+          m_since{ 0 }
     {
+        std::size_t required{ 0 };
+        (
+            [&](SparseSet* set) {
+                if constexpr (QueryParam<Params>::REQUIRED)
+                    m_required[required++] = set;
+            }(pool),
+            ...);
+
         Refresh();
     }
 
     constexpr void Refresh()
     {
-        m_minIndex = 0;
+        m_driver = m_required[0];
 
-        for (std::size_t i{ 1 }; i < m_pools.size(); ++i)
+        for (std::size_t i{ 1 }; i < m_required.size(); ++i)
         {
-            if (m_pools[i]->Size() < m_pools[m_minIndex]->Size())
-            {
-                m_minIndex = i;
-            }
+            if (m_required[i]->Size() < m_driver->Size())
+                m_driver = m_required[i];
         }
     }
 
-    constexpr void Each(std::function<void(Components&...)>&& function)
+    // Reference tick of Changed/Added filters, entries stamped after it
+    // match. Defaults to zero which matches every entry.
+    constexpr Query& Since(std::uint32_t tick) noexcept
     {
-        for (auto entity : *m_pools[m_minIndex])
+        m_since = tick;
+        return *this;
+    }
+
+    template <typename Func>
+    constexpr void Each(Func&& function)
+    {
+        Each(0, Size(), function);
+    }
+
+    // Visits matches among entries [first, last) of the driving pool.
+    template <typename Func>
+    constexpr void Each(std::size_t first, std::size_t last, Func&& function)
+    {
+        const Entity* entities{ m_driver->Data() };
+
+        for (std::size_t i{ first }; i < last; ++i)
         {
-            if (AllOf(entity))
-            {
-                Each(
-                    std::forward<std::function<void(Components & ...)>>(
-                        function),
-                    entity,
-                    std::index_sequence_for<Components...>{});
-            }
+            if (Matches(entities[i]))
+                std::apply(function, Fetch(entities[i]));
         }
     }
 
+    // Splits the driving pool into batches executed on the job system.
+    // The function is called concurrently and has to be thread safe.
+    template <typename Func>
+    void ParallelEach(
+        Func&& function,
+        std::uint32_t batchSize = JobSystem::DEFAULT_BATCH_SIZE)
+    {
+        JobSystem::ParallelFor(
+            static_cast<std::uint32_t>(Size()),
+            batchSize,
+            [this, &function](std::uint32_t first, std::uint32_t last) {
+                Each(first, last, function);
+            });
+    }
+
+    // Upper bound of matches, the size of the driving pool.
+    constexpr std::size_t Size() const noexcept
+    {
+        return m_driver->Size();
+    }
+
+    [[nodiscard]] Range Slice(std::size_t first, std::size_t last) const
+    {
+        const auto begin{ m_driver->begin() };
+        const auto end{ begin + static_cast<std::ptrdiff_t>(last) };
+
+        return Range{
+            .first = iterator(
+                this,
+                begin + static_cast<std::ptrdiff_t>(first),
+                end),
+            .last = iterator(this, end, end),
+        };
+    }
+
     [[nodiscard]] iterator begin() const noexcept
     {
-        return iterator(m_pools, m_minIndex, m_pools[m_minIndex]->begin());
+        return iterator(this, m_driver->begin(), m_driver->end());
     }
 
     [[nodiscard]] iterator end() const noexcept
     {
-        return iterator(m_pools, m_minIndex, m_pools[m_minIndex]->end());
+        return iterator(this, m_driver->end(), m_driver->end());
     }
 
-private:
-    constexpr bool AllOf(Entity entity)
+    constexpr bool Matches(const Entity entity) const
     {
-        for (std::size_t i{ 0 }; i < m_pools.size(); ++i)
+        for (const SparseSet* pool : m_required)
         {
-            if (!m_pools[i]->Contains(entity))
+            if (!pool->Contains(entity))
                 return false;
         }
 
-        return true;
+        return Matches(entity, std::index_sequence_for<Params...>{});
+    }
+
+    // Arguments of the callback for a matching entity.
+    constexpr auto Fetch(const Entity entity) const
+    {
+        return Fetch(entity, std::index_sequence_for<Params...>{});
     }
 
+private:
+    static constexpr std::size_t REQUIRED_COUNT{
+        (std::size_t{ QueryParam<Params>::REQUIRED } + ...)
+    };
+
+    static_assert(REQUIRED_COUNT > 0, "Query needs a required component");
+
     template <std::size_t... Index>
-    constexpr void Each(
-        std::function<void(Components&...)>&& function,
+    constexpr bool Matches(
         const Entity entity,
-        std::index_sequence<Index...>) const noexcept
+        std::index_sequence<Index...>) const
+    {
+        return (
+            QueryParam<Params>::Matches(
+                std::get<Index>(m_pools),
+                entity,
+                m_since) &&
+            ...);
+    }
+
+    template <std::size_t... Index>
+    constexpr auto Fetch(const Entity entity, std::index_sequence<Index...>)
+        const
     {
-        function(
-            reinterpret_cast<ComponentSparseSet<Components>*>(m_pools[Index])
-                ->Get(entity)...);
+        return std::tuple_cat(
+            QueryParam<Params>::Fetch(std::get<Index>(m_pools), entity)...);
     }
 
 private:
-    const std::array<SparseSet*, sizeof...(Components)> m_pools;
-    std::size_t m_minIndex;
+    std::tuple<typename QueryParam<Params>::Pool*...> m_pools;
+    std::array<SparseSet*, REQUIRED_COUNT> m_required;
+    SparseSet* m_driver;
+    std::uint32_t m_since;
 };
 }
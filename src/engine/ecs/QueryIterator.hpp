@@ -1,26 +1,26 @@
 #pragma once
 
-#include "ecs/ComponentSparseSet.hpp"
 #include "ecs/SparseSet.hpp"
 
-#include <array>
 #include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 namespace Zeus::ECS
 {
-template <typename... Components>
+template <typename Query>
 class QueryIterator
 {
 public:
     constexpr QueryIterator(
-        const std::array<SparseSet*, sizeof...(Components)>& pools,
-        std::size_t minIndex,
-        SparseSet::iterator current)
-        : m_pools{ pools },
-          m_minIndex{ minIndex },
-          m_current{ current }
+        const Query* query,
+        SparseSet::iterator current,
+        SparseSet::iterator last)
+        : m_query{ query },
+          m_current{ current },
+          m_last{ last }
     {
+        SeekNext();
     }
 
     constexpr QueryIterator& operator++() noexcept
@@ -34,9 +34,28 @@ public:
         return operator++(), copy;
     }
 
+    // A single argument is returned as is, several (or none, when the query
+    // only has tags and filters) as a tuple.
     [[nodiscard]] constexpr decltype(auto) operator*() const noexcept
     {
-        return Get(std::index_sequence_for<Components...>{});
+        auto arguments{ m_query->Fetch(*m_current) };
+        using Arguments = decltype(arguments);
+
+        if constexpr (std::tuple_size_v<Arguments> != 1)
+        {
+            return arguments;
+        }
+        else
+        {
+            using Argument = std::tuple_element_t<0, Arguments>;
+
+            // Values, e.g. the pointer of an Optional, live in the local
+            // tuple and are returned by copy.
+            if constexpr (std::is_lvalue_reference_v<Argument>)
+                return std::get<0>(arguments);
+            else
+                return Argument{ std::get<0>(arguments) };
+        }
     }
 
     constexpr bool operator==(const QueryIterator& other) const noexcept
@@ -45,46 +64,16 @@ public:
     }
 
 private:
-    template <std::size_t... Index>
-    constexpr decltype(auto) Get(std::index_sequence<Index...>) const noexcept
-    {
-        static_assert(sizeof...(Index) > 0);
-
-        if constexpr (sizeof...(Index) == 1)
-            return (
-                reinterpret_cast<ComponentSparseSet<Components>*>(
-                    m_pools[Index])
-                    ->Get(*m_current),
-                ...);
-        else
-            return std::forward_as_tuple(
-                reinterpret_cast<ComponentSparseSet<Components>*>(
-                    m_pools[Index])
-                    ->Get(*m_current)...);
-    }
-
     constexpr void SeekNext() noexcept
     {
-        for (SparseSet::iterator end{ m_pools[m_minIndex]->end() };
-             m_current != end && !IsValid();
+        for (; m_current != m_last && !m_query->Matches(*m_current);
              ++m_current)
             ;
     }
 
-    constexpr bool IsValid()
-    {
-        for (std::size_t i{ 0 }; i < m_pools.size(); ++i)
-        {
-            if (!m_pools[i]->Contains(*m_current))
-                return false;
-        }
-
-        return true;
-    }
-
 private:
-    const std::array<SparseSet*, sizeof...(Components)>& m_pools;
-    std::size_t m_minIndex;
+    const Query* m_query;
     SparseSet::iterator m_current;
+    SparseSet::iterator m_last;
 };
 }
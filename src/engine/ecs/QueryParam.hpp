@@ -0,0 +1,126 @@
+#pragma once
+
+#include "ecs/ComponentSparseSet.hpp"
+#include "ecs/Entity.hpp"
+
+#include <cstdint>
+#include <tuple>
+
+namespace Zeus::ECS
+{
+// Matches entities whose component changed after the query's Since tick.
+template <typename Component>
+struct Changed
+{
+};
+
+// Matches entities whose component was added after the query's Since tick.
+template <typename Component>
+struct Added
+{
+};
+
+// Matches entities without the component.
+template <typename Component>
+struct Without
+{
+};
+
+// Yields a pointer to the component, null when the entity does not have it.
+template <typename Component>
+struct Optional
+{
+};
+
+// Describes how a query parameter takes part in the query. Required pools
+// must contain the entity and one of them drives the iteration, Matches adds
+// further conditions and Fetch yields the arguments passed to the callback.
+template <typename Type>
+struct QueryParam
+{
+    using Component = Type;
+    using Pool = ComponentSparseSet<Component>;
+
+    static constexpr bool REQUIRED{ true };
+
+    static bool Matches(const Pool*, const Entity, std::uint32_t)
+    {
+        return true;
+    }
+
+    // Tags are matched but not passed to the callback.
+    static auto Fetch(Pool* pool, const Entity entity)
+    {
+        if constexpr (Pool::IS_TAG)
+            return std::tuple<>{};
+        else
+            return std::tuple<Component&>{ pool->Get(entity) };
+    }
+};
+
+template <typename Type>
+struct QueryParam<Changed<Type>> : QueryParam<Type>
+{
+    using typename QueryParam<Type>::Pool;
+
+    static bool Matches(
+        const Pool* pool,
+        const Entity entity,
+        std::uint32_t since)
+    {
+        return pool->ChangedTick(entity) > since;
+    }
+};
+
+template <typename Type>
+struct QueryParam<Added<Type>> : QueryParam<Type>
+{
+    using typename QueryParam<Type>::Pool;
+
+    static bool Matches(
+        const Pool* pool,
+        const Entity entity,
+        std::uint32_t since)
+    {
+        return pool->AddedTick(entity) > since;
+    }
+};
+
+template <typename Type>
+struct QueryParam<Without<Type>>
+{
+    using Component = Type;
+    using Pool = ComponentSparseSet<Component>;
+
+    static constexpr bool REQUIRED{ false };
+
+    static bool Matches(const Pool* pool, const Entity entity, std::uint32_t)
+    {
+        return !pool->Contains(entity);
+    }
+
+    static std::tuple<> Fetch(Pool*, const Entity)
+    {
+        return {};
+    }
+};
+
+template <typename Type>
+struct QueryParam<Optional<Type>>
+{
+    using Component = Type;
+    using Pool = ComponentSparseSet<Component>;
+
+    static constexpr bool REQUIRED{ false };
+
+    static bool Matches(const Pool*, const Entity, std::uint32_t)
+    {
+        return true;
+    }
+
+    static std::tuple<Component*> Fetch(Pool* pool, const Entity entity)
+    {
+        return { pool->Contains(entity) ? &pool->Get(entity) : nullptr };
+    }
+};
+}
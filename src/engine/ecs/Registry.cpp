@@ -0,0 +1,203 @@
+#include "Registry.hpp"
+
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+#include "GroupHandler.hpp"
+#include "SparseSet.hpp"
+#include "logging/logger.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+Registry::Registry(std::pmr::memory_resource* resource)
+    : m_pools{},
+      m_owners{},
+      m_groups{},
+      m_entities{},
+      m_tick{ 1 },
+      m_resource{ resource }
+{
+}
+
+Entity Registry::Create()
+{
+    return m_entities.Create();
+}
+
+void Registry::Destroy(const Entity entity)
+{
+    DestroyEntities(&entity, &entity + 1);
+}
+
+void Registry::DestroyEntities(const Entity* first, const Entity* last)
+{
+    for (std::size_t family{ 0 }; family < m_pools.size(); ++family)
+    {
+        SparseSet* pool{ m_pools[family].get() };
+
+        if (pool == nullptr || pool->Empty())
+            continue;
+
+        // Owning groups have to see every removal before it happens.
+        if (GroupHandler* group{ m_owners[family] })
+        {
+            for (const Entity* entity{ first }; entity != last; ++entity)
+            {
+                if (!pool->Contains(*entity))
+                    continue;
+
+                group->OnErase(*entity);
+                pool->Pop(*entity);
+            }
+        }
+        else
+        {
+            pool->PopMany(first, last);
+        }
+    }
+
+    for (; first != last; ++first)
+        m_entities.Destroy(*first);
+}
+
+bool Registry::InstantiateEntities(
+    const Entity prefab,
+    Entity* first,
+    Entity* last)
+{
+    assert(IsValid(prefab) && "Invalid entity");
+
+    // Checked up front, instances never miss one of the prefab's components.
+    const bool cloneable{ std::all_of(
+        m_pools.begin(),
+        m_pools.end(),
+        [prefab](const auto& pool) {
+            return pool == nullptr || !pool->Contains(prefab) ||
+                   pool->IsCloneable();
+        }) };
+
+    if (!cloneable)
+    {
+        LOG_ERROR("Prefab holds a component that cannot be copied");
+        return false;
+    }
+
+    const auto count{ static_cast<std::size_t>(last - first) };
+
+    m_entities.Reserve(m_entities.Size() + count);
+    for (Entity* entity{ first }; entity != last; ++entity)
+        *entity = m_entities.Create();
+
+    for (std::size_t family{ 0 }; family < m_pools.size(); ++family)
+    {
+        SparseSet* pool{ m_pools[family].get() };
+
+        if (pool == nullptr || !pool->Contains(prefab))
+            continue;
+
+        pool->CloneMany(prefab, first, last);
+
+        if (GroupHandler* group{ m_owners[family] })
+        {
+            for (const Entity* entity{ first }; entity != last; ++entity)
+                group->OnEmplace(*entity);
+        }
+    }
+
+    return true;
+}
+
+void Registry::Clear()
+{
+    for (auto& pool : m_pools)
+    {
+        if (pool != nullptr)
+            pool->Clear();
+    }
+
+    for (auto& group : m_groups)
+    {
+        group->Clear();
+    }
+
+    m_entities.Clear();
+}
+
+bool Registry::IsValid(const Entity entity) const
+{
+    return m_entities.IsValid(entity);
+}
+
+std::uint32_t Registry::Tick() const
+{
+    return m_tick;
+}
+
+std::uint32_t Registry::AdvanceTick()
+{
+    return ++m_tick;
+}
+
+SparseSet* Registry::CreatePool(Family family, PoolFactory factory)
+{
+    if (family >= m_pools.size())
+    {
+        m_pools.resize(family + 1u);
+        m_owners.resize(family + 1u, nullptr);
+    }
+
+    assert(m_pools[family] == nullptr && "Pool already exists");
+
+    m_pools[family] = factory(&m_tick, m_resource);
+    return m_pools[family].get();
+}
+
+GroupHandler& Registry::AssureGroup(
+    std::vector<Family>&& families,
+    std::vector<SparseSet*>&& pools)
+{
+    std::vector<std::size_t> order(families.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&families](auto lhs, auto rhs) {
+        return families[lhs] < families[rhs];
+    });
+
+    std::vector<Family> sortedFamilies{};
+    std::vector<SparseSet*> sortedPools{};
+    for (const std::size_t index : order)
+    {
+        sortedFamilies.push_back(families[index]);
+        sortedPools.push_back(pools[index]);
+    }
+
+    if (GroupHandler* owner{ m_owners[sortedFamilies.front()] })
+    {
+        assert(
+            owner->Families() == sortedFamilies &&
+            "Component is owned by another group");
+
+        return *owner;
+    }
+
+    auto& group{ m_groups.emplace_back(std::make_unique<GroupHandler>(
+        std::vector<Family>{ sortedFamilies },
+        std::move(sortedPools))) };
+
+    for (const Family family : sortedFamilies)
+    {
+        assert(m_owners[family] == nullptr && "Component is already owned");
+        m_owners[family] = group.get();
+    }
+
+    return *group;
+}
+}
@@ -2,31 +2,40 @@
 
 #include "ComponentSparseSet.hpp"
 #include "Entity.hpp"
+#include "EntityPool.hpp"
 #include "FamilyId.hpp"
+#include "Group.hpp"
+#include "GroupHandler.hpp"
 #include "Query.hpp"
+#include "QueryParam.hpp"
+#include "Signal.hpp"
 #include "SparseSet.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace Zeus::ECS
 {
 class Registry
 {
 public:
-    Registry() : m_pools{}, m_entities()
-    {
-    }
+    // Component pools allocate their dense arrays from the resource.
+    Registry(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
-    Entity Create()
-    {
-        Entity newEntity{ m_lastEntity++ };
-        m_entities.Push(newEntity);
-        return newEntity;
-    }
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    Entity Create();
 
     template <typename Component, typename... Args>
     Entity Create(Args&&... args)
@@ -37,42 +46,108 @@ public:
         return newEntity;
     }
 
-    void Destroy(const Entity entity)
+    // Creates count entities and writes their handles to out.
+    template <typename OutputIt>
+    OutputIt CreateMany(std::size_t count, OutputIt out)
+    {
+        m_entities.Reserve(m_entities.Size() + count);
+
+        for (std::size_t i{ 0 }; i < count; ++i)
+            *out++ = m_entities.Create();
+
+        return out;
+    }
+
+    // Creates count entities holding a copy of every component of the
+    // prefab, handles are written to out. Pools grow once per call.
+    // Nothing is created when the prefab holds a component that cannot be
+    // copied, out is returned unchanged.
+    template <typename OutputIt>
+    OutputIt Instantiate(const Entity prefab, std::size_t count, OutputIt out)
     {
-        for (auto& pool : m_pools)
+        if constexpr (std::contiguous_iterator<OutputIt>)
         {
-            pool.second->Pop(entity);
+            Entity* first{ std::to_address(out) };
+            if (!InstantiateEntities(prefab, first, first + count))
+                return out;
+
+            return out + static_cast<std::ptrdiff_t>(count);
         }
+        else
+        {
+            std::vector<Entity> entities(count);
+            if (!InstantiateEntities(
+                    prefab,
+                    entities.data(),
+                    entities.data() + count))
+            {
+                return out;
+            }
 
-        m_entities.Pop(entity);
+            return std::copy(entities.begin(), entities.end(), out);
+        }
     }
 
-    void Clear()
+    void Destroy(const Entity entity);
+
+    // Destroys the entities one pool at a time rather than one entity at a
+    // time. The range must not refer to the registry's own storage.
+    template <std::forward_iterator It>
+    void DestroyMany(It first, It last)
     {
-        for (auto& pool : m_pools)
+        if constexpr (std::contiguous_iterator<It>)
         {
-            pool.second->Clear();
+            DestroyEntities(std::to_address(first), std::to_address(last));
+        }
+        else
+        {
+            const std::vector<Entity> entities(first, last);
+            DestroyEntities(
+                entities.data(),
+                entities.data() + entities.size());
         }
-
-        m_entities.Clear();
     }
 
+    void Clear();
+
     template <typename Component, typename... Args>
     decltype(auto) Emplace(const Entity entity, Args&&... args)
     {
-        if (!m_entities.Contains(entity))
-            m_entities.Push(entity);
+        if (!m_entities.IsValid(entity))
+            Insert(entity);
 
-        Family family{ FamilyId::Type<Component>() };
+        auto* pool{ GetPool<Component>() };
+        auto& component{ pool->Emplace(entity, std::forward<Args>(args)...) };
 
-        if (!m_pools.contains(family))
+        // Joining a group moves the component within the pool.
+        if (GroupHandler* group{ Owner(FamilyId::Type<Component>()) })
         {
-            m_pools[family] = new ComponentSparseSet<Component>();
+            group->OnEmplace(entity);
+            return pool->Get(entity);
         }
 
-        return GetPool<Component>()->Emplace(
-            entity,
-            std::forward<Args>(args)...);
+        return component;
+    }
+
+    // Adds a copy of the value to every entity, the pool grows once.
+    template <typename Component, std::forward_iterator It>
+    void EmplaceMany(It first, It last, const Component& value = {})
+    {
+        InsertMissing(first, last);
+        GetPool<Component>()->EmplaceMany(first, last, value);
+        NotifyEmplaced<Component>(first, last);
+    }
+
+    // Adds the components read from values, one per entity.
+    template <
+        typename Component,
+        std::forward_iterator It,
+        std::input_iterator ValueIt>
+    void EmplaceMany(It first, It last, ValueIt values)
+    {
+        InsertMissing(first, last);
+        GetPool<Component>()->EmplaceMany(first, last, values);
+        NotifyEmplaced<Component>(first, last);
     }
 
     template <typename Component>
@@ -91,7 +166,12 @@ public:
         static_assert(sizeof...(Components) > 0);
         if constexpr (sizeof...(Components) == 1u)
         {
-            GetPool<Components...>()->Pop(entity);
+            auto* pool{ GetPool<Components...>() };
+
+            if (GroupHandler* group{ Owner(FamilyId::Type<Components...>()) })
+                group->OnErase(entity);
+
+            pool->Pop(entity);
         }
         else
         {
@@ -113,13 +193,88 @@ public:
         }
     }
 
+    // Like Get but marks the components as changed.
     template <typename... Components>
-    decltype(auto) QueryAll()
+    [[nodiscard]] decltype(auto) GetMutable(const Entity entity)
     {
         static_assert(sizeof...(Components) > 0);
-        return Query<Components...>(GetPool<Components>()...);
+        if constexpr (sizeof...(Components) == 1u)
+        {
+            return (GetPool<Components>()->GetMutable(entity), ...);
+        }
+        else
+        {
+            return std::forward_as_tuple(
+                GetPool<Components>()->GetMutable(entity)...);
+        }
+    }
+
+    // Parameters are components or filters such as Changed<T>, Without<T>
+    // and Optional<T>, see QueryParam.
+    template <typename... Params>
+    decltype(auto) QueryAll()
+    {
+        static_assert(sizeof...(Params) > 0);
+        return Query<Params...>(
+            GetPool<typename QueryParam<Params>::Component>()...);
+    }
+
+    // Starts recording the entities losing the component. Pools are not
+    // tracked by default, EachRemoved starts tracking on its first call.
+    template <typename Component>
+    void TrackRemoved()
+    {
+        GetPool<Component>()->TrackRemovals();
+    }
+
+    // Calls function(entity) for entities which lost the component after the
+    // tick, including destroyed ones, once the removals are tracked.
+    template <typename Component, typename Func>
+    void EachRemoved(std::uint32_t since, Func&& function)
+    {
+        auto* pool{ GetPool<Component>() };
+        pool->TrackRemovals();
+
+        for (const auto& removal : pool->Removed())
+        {
+            if (removal.tick > since)
+                function(removal.entity);
+        }
+    }
+
+    // Removals are kept until trimmed, call it once every consumer has seen
+    // the tick.
+    template <typename Component>
+    void TrimRemoved(std::uint32_t tick)
+    {
+        GetPool<Component>()->TrimRemoved(tick);
     }
 
+    // Signals of the component's pool, listeners receive the entity.
+    template <typename Component>
+    Signal<Entity>& OnConstruct()
+    {
+        return GetPool<Component>()->OnConstruct();
+    }
+
+    template <typename Component>
+    Signal<Entity>& OnUpdate()
+    {
+        return GetPool<Component>()->OnUpdate();
+    }
+
+    template <typename Component>
+    Signal<Entity>& OnDestroy()
+    {
+        return GetPool<Component>()->OnDestroy();
+    }
+
+    // Changes are stamped with the current tick. A consumer remembers the
+    // tick it ran at and passes it to Query::Since on its next run, the
+    // tick is advanced between the runs, usually once per frame.
+    std::uint32_t Tick() const;
+    std::uint32_t AdvanceTick();
+
     template <typename... Components>
     bool AnyOf(const Entity entity)
     {
@@ -140,29 +295,143 @@ public:
         }
     }
 
-    bool IsValid(const Entity entity)
+    // Owning group of the components, created on first use. A component
+    // can be owned by a single group, which reorders its pool.
+    template <typename... Owned>
+    ECS::Group<Owned...> Group()
+    {
+        static_assert(sizeof...(Owned) > 1);
+
+        GroupHandler& handler{ AssureGroup(
+            { FamilyId::Type<Owned>()... },
+            { static_cast<SparseSet*>(GetPool<Owned>())... }) };
+
+        return ECS::Group<Owned...>(handler, GetPool<Owned>()...);
+    }
+
+    bool IsValid(const Entity entity) const;
+
+    // Makes room for count more components without reallocating.
+    template <typename Component>
+    void Reserve(std::size_t count)
+    {
+        auto* pool{ GetPool<Component>() };
+
+        if (pool->Size() + count > pool->Capacity())
+            pool->Reserve(pool->Size() + count);
+    }
+
+    // Reorders the pool by component, queries driven by it follow the new
+    // order. Pools owned by a group keep the group's order.
+    template <typename Component, typename Compare>
+    void Sort(Compare compare, SortMode mode = SortMode::Full)
+    {
+        auto* pool{ GetPool<Component>() };
+
+        assert(
+            Owner(FamilyId::Type<Component>()) == nullptr &&
+            "Component is owned by a group");
+
+        pool->Sort(std::move(compare), mode);
+    }
+
+    // Creates the pools up front, pools are otherwise created on first use.
+    template <typename... Components>
+    void Assure()
     {
-        return m_entities.Contains(entity);
+        static_assert(sizeof...(Components) > 0);
+        (GetPool<Components>(), ...);
     }
 
 private:
+    friend class Snapshot;
+
+    using PoolFactory = std::unique_ptr<SparseSet> (*)(
+        const std::uint32_t* tick,
+        std::pmr::memory_resource* resource);
+
+    // Families are small dense integers, so the pool is a bounds check and a
+    // load away. Creating the pool is kept out of line.
     template <typename Component>
     ComponentSparseSet<Component>* GetPool()
     {
-        Family family{ FamilyId::Type<Component>() };
+        const Family family{ FamilyId::Type<Component>() };
 
-        if (!m_pools.contains(family))
+        if (family < m_pools.size() && m_pools[family] != nullptr) [[likely]]
         {
-            m_pools[family] = new ComponentSparseSet<Component>();
+            return static_cast<ComponentSparseSet<Component>*>(
+                m_pools[family].get());
         }
 
-        return static_cast<ComponentSparseSet<Component>*>(m_pools[family]);
+        return static_cast<ComponentSparseSet<Component>*>(
+            CreatePool(
+                family,
+                [](const std::uint32_t* tick,
+                   std::pmr::memory_resource* resource)
+                    -> std::unique_ptr<SparseSet> {
+                    auto pool{
+                        std::make_unique<ComponentSparseSet<Component>>(
+                            0,
+                            resource)
+                    };
+                    pool->BindTick(tick);
+
+                    return pool;
+                }));
     }
 
-private:
-    Entity m_lastEntity{};
+    SparseSet* CreatePool(Family family, PoolFactory factory);
+
+    void DestroyEntities(const Entity* first, const Entity* last);
+    bool InstantiateEntities(
+        const Entity prefab,
+        Entity* first,
+        Entity* last);
 
-    std::unordered_map<std::uint32_t, SparseSet*> m_pools;
-    SparseSet m_entities;
+    // Registers a handle the registry never issued, stale handles of
+    // destroyed entities are rejected.
+    void Insert(const Entity entity)
+    {
+        assert(!m_entities.IsIssued(entity) && "Stale entity");
+        m_entities.Insert(entity);
+    }
+
+    template <typename It>
+    void InsertMissing(It first, It last)
+    {
+        for (; first != last; ++first)
+        {
+            if (!m_entities.IsValid(*first))
+                Insert(*first);
+        }
+    }
+
+    template <typename Component, typename It>
+    void NotifyEmplaced(It first, It last)
+    {
+        if (GroupHandler* group{ Owner(FamilyId::Type<Component>()) })
+        {
+            for (; first != last; ++first)
+                group->OnEmplace(*first);
+        }
+    }
+
+    // Only valid for families with a pool.
+    GroupHandler* Owner(Family family) const
+    {
+        return m_owners[family];
+    }
+
+    GroupHandler& AssureGroup(
+        std::vector<Family>&& families,
+        std::vector<SparseSet*>&& pools);
+
+private:
+    std::vector<std::unique_ptr<SparseSet>> m_pools;
+    std::vector<GroupHandler*> m_owners;
+    std::vector<std::unique_ptr<GroupHandler>> m_groups;
+    EntityPool m_entities;
+    std::uint32_t m_tick;
+    std::pmr::memory_resource* m_resource;
 };
 }
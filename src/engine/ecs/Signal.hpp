@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+template <typename>
+class Delegate;
+
+// Non-owning callable, a function pointer plus the instance it is called on.
+// Binding never allocates, bound instances have to outlive the delegate.
+template <typename Return, typename... Args>
+class Delegate<Return(Args...)>
+{
+public:
+    Delegate() = default;
+
+    template <auto Function>
+    static Delegate Bind()
+    {
+        return Delegate(
+            [](void*, Args... args) -> Return {
+                return Function(std::forward<Args>(args)...);
+            },
+            nullptr);
+    }
+
+    template <auto Method, typename Instance>
+    static Delegate Bind(Instance& instance)
+    {
+        return Delegate(
+            [](void* data, Args... args) -> Return {
+                return (static_cast<Instance*>(data)->*Method)(
+                    std::forward<Args>(args)...);
+            },
+            const_cast<void*>(
+                static_cast<const void*>(std::addressof(instance))));
+    }
+
+    // Lambdas and other function objects, called through operator().
+    template <typename Func>
+    static Delegate Bind(Func& function)
+    {
+        return Delegate(
+            [](void* data, Args... args) -> Return {
+                return (*static_cast<Func*>(data))(
+                    std::forward<Args>(args)...);
+            },
+            const_cast<void*>(
+                static_cast<const void*>(std::addressof(function))));
+    }
+
+    Return operator()(Args... args) const
+    {
+        return m_function(m_instance, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const
+    {
+        return m_function != nullptr;
+    }
+
+    bool operator==(const Delegate& other) const = default;
+
+private:
+    using Function = Return (*)(void*, Args...);
+
+    Delegate(Function function, void* instance)
+        : m_function{ function },
+          m_instance{ instance }
+    {
+    }
+
+    Function m_function{ nullptr };
+    void* m_instance{ nullptr };
+};
+
+// Listeners are called in connection order. Publishing checks for listeners
+// first, an unobserved signal costs a size comparison.
+// Listeners must not connect or disconnect while the signal publishes.
+template <typename... Args>
+class Signal
+{
+public:
+    using Listener = Delegate<void(Args...)>;
+
+    void Connect(const Listener& listener)
+    {
+        m_listeners.push_back(listener);
+    }
+
+    void Disconnect(const Listener& listener)
+    {
+        auto found{
+            std::find(m_listeners.begin(), m_listeners.end(), listener)
+        };
+
+        if (found != m_listeners.end())
+            m_listeners.erase(found);
+    }
+
+    void Clear()
+    {
+        m_listeners.clear();
+    }
+
+    void Publish(Args... args) const
+    {
+        for (const Listener& listener : m_listeners)
+        {
+            listener(args...);
+        }
+    }
+
+    bool Empty() const
+    {
+        return m_listeners.empty();
+    }
+
+    std::size_t Size() const
+    {
+        return m_listeners.size();
+    }
+
+private:
+    std::vector<Listener> m_listeners;
+};
+}
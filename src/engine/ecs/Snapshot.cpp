@@ -0,0 +1,221 @@
+#include "Snapshot.hpp"
+
+#include "Entity.hpp"
+#include "GroupHandler.hpp"
+#include "Registry.hpp"
+#include "SparseSet.hpp"
+#include "core/Hasher.hpp"
+#include "logging/logger.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+namespace
+{
+constexpr std::uint32_t SNAPSHOT_MAGIC{ 0x504E535A }; // "ZSNP"
+constexpr std::uint32_t SNAPSHOT_VERSION{ 1 };
+
+struct Header
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t entityCount;
+    std::uint32_t poolCount;
+};
+
+struct PoolHeader
+{
+    Hash name;
+    std::uint32_t size;
+};
+}
+
+bool Snapshot::Save(const Registry& registry, std::ostream& stream) const
+{
+    std::vector<std::pair<const Entry*, const SparseSet*>> pools{};
+    for (const Entry& entry : m_entries)
+    {
+        if (entry.family < registry.m_pools.size() &&
+            registry.m_pools[entry.family] != nullptr &&
+            registry.m_pools[entry.family]->Size() > 0)
+        {
+            pools.emplace_back(&entry, registry.m_pools[entry.family].get());
+        }
+    }
+
+    const SparseSet& alive{ registry.m_entities.Alive() };
+
+    const Header header{
+        .magic = SNAPSHOT_MAGIC,
+        .version = SNAPSHOT_VERSION,
+        .entityCount = static_cast<std::uint32_t>(alive.Size()),
+        .poolCount = static_cast<std::uint32_t>(pools.size()),
+    };
+    WriteBytes(stream, &header, sizeof(header));
+    WriteBytes(stream, alive.Data(), alive.Size() * sizeof(Entity));
+
+    for (const auto& [entry, pool] : pools)
+    {
+        const PoolHeader poolHeader{
+            .name = entry->name,
+            .size = static_cast<std::uint32_t>(pool->Size()),
+        };
+        WriteBytes(stream, &poolHeader, sizeof(poolHeader));
+        WriteBytes(stream, pool->Data(), pool->Size() * sizeof(Entity));
+
+        entry->save(*pool, stream);
+    }
+
+    if (!stream)
+    {
+        LOG_ERROR("Failed to write snapshot");
+        return false;
+    }
+
+    return true;
+}
+
+bool Snapshot::Load(Registry& registry, std::istream& stream) const
+{
+    registry.Clear();
+
+    const auto fail{ [&registry]([[maybe_unused]] const char* message) {
+        LOG_ERROR("Failed to load snapshot: {}", message);
+        registry.Clear();
+        return false;
+    } };
+
+    Header header{};
+    if (!ReadBytes(stream, &header, sizeof(header)) ||
+        header.magic != SNAPSHOT_MAGIC)
+    {
+        return fail("Invalid snapshot");
+    }
+
+    if (header.version != SNAPSHOT_VERSION)
+        return fail("Unsupported snapshot version");
+
+    // Sizes are checked against the stream before allocating for them.
+    if (std::size_t{ header.entityCount } * sizeof(Entity) > Remaining(stream))
+        return fail("Truncated snapshot");
+
+    std::vector<Entity> entities(header.entityCount);
+    if (!ReadBytes(stream, entities.data(), entities.size() * sizeof(Entity)))
+        return fail("Truncated snapshot");
+
+    registry.m_entities.Assign(std::move(entities));
+
+    std::vector<std::pair<const Entry*, SparseSet*>> loaded{};
+
+    for (std::uint32_t i{ 0 }; i < header.poolCount; ++i)
+    {
+        PoolHeader poolHeader{};
+        if (!ReadBytes(stream, &poolHeader, sizeof(poolHeader)))
+            return fail("Truncated snapshot");
+
+        const Entry* entry{ Find(poolHeader.name) };
+        if (entry == nullptr)
+            return fail("Snapshot contains an unregistered component");
+
+        if (std::size_t{ poolHeader.size } * sizeof(Entity) > Remaining(stream))
+            return fail("Truncated snapshot");
+
+        std::vector<Entity> poolEntities(poolHeader.size);
+        if (!ReadBytes(
+                stream,
+                poolEntities.data(),
+                poolEntities.size() * sizeof(Entity)))
+        {
+            return fail("Truncated snapshot");
+        }
+
+        if (!std::all_of(
+                poolEntities.begin(),
+                poolEntities.end(),
+                [&registry](const Entity entity) {
+                    return registry.m_entities.IsValid(entity);
+                }))
+        {
+            return fail("Snapshot component belongs to a dead entity");
+        }
+
+        SparseSet& pool{ *entry->assure(registry) };
+        entry->assign(pool, std::move(poolEntities));
+
+        if (!entry->load(pool, stream))
+            return fail("Truncated snapshot");
+
+        loaded.emplace_back(entry, &pool);
+    }
+
+    // Pools were filled behind the groups' back.
+    for (auto& group : registry.m_groups)
+    {
+        group->Refresh();
+    }
+
+    // Listeners see the loaded components, of every pool.
+    for (const auto& [entry, pool] : loaded)
+    {
+        entry->publish(*pool);
+    }
+
+    return true;
+}
+
+std::size_t Snapshot::Size() const
+{
+    return m_entries.size();
+}
+
+const Snapshot::Entry* Snapshot::Find(Hash name) const
+{
+    auto entry{ std::find_if(
+        m_entries.begin(),
+        m_entries.end(),
+        [name](const Entry& other) { return other.name == name; }) };
+
+    return entry != m_entries.end() ? &*entry : nullptr;
+}
+
+void Snapshot::WriteBytes(
+    std::ostream& stream,
+    const void* data,
+    std::size_t size)
+{
+    stream.write(
+        static_cast<const char*>(data),
+        static_cast<std::streamsize>(size));
+}
+
+bool Snapshot::ReadBytes(std::istream& stream, void* data, std::size_t size)
+{
+    stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(stream.gcount()) == size;
+}
+
+std::size_t Snapshot::Remaining(std::istream& stream)
+{
+    const std::istream::pos_type position{ stream.tellg() };
+    if (position == std::istream::pos_type(-1))
+        return std::numeric_limits<std::size_t>::max();
+
+    stream.seekg(0, std::ios::end);
+    const std::istream::pos_type end{ stream.tellg() };
+    stream.seekg(position);
+
+    if (end == std::istream::pos_type(-1))
+        return std::numeric_limits<std::size_t>::max();
+
+    return static_cast<std::size_t>(end - position);
+}
+}
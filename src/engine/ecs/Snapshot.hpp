@@ -0,0 +1,172 @@
+#pragma once
+
+#include "ComponentSparseSet.hpp"
+#include "Entity.hpp"
+#include "FamilyId.hpp"
+#include "Registry.hpp"
+#include "SparseSet.hpp"
+#include "core/Hasher.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+// Saves and loads the entities and registered components of a registry in a
+// compact binary format, in native byte order.
+// Every pool is written as its dense entity array followed by its components.
+// Trivially copyable components are copied as one block both ways, other
+// components go through the serializer they were registered with. Components
+// are matched by the hash of their registered name, not by family.
+class Snapshot
+{
+public:
+    template <typename Component>
+    using SaveFunction = std::function<void(std::ostream&, const Component&)>;
+
+    template <typename Component>
+    using LoadFunction = std::function<void(std::istream&, Component&)>;
+
+    template <typename Component>
+    void Register(std::string_view name)
+    {
+        static_assert(
+            std::is_trivially_copyable_v<Component>,
+            "Component requires a serializer");
+
+        Add<Component>(
+            name,
+            [](const SparseSet& pool, std::ostream& stream) {
+                if constexpr (!ComponentSparseSet<Component>::IS_TAG)
+                {
+                    WriteBytes(
+                        stream,
+                        Cast<Component>(pool).Components(),
+                        pool.Size() * sizeof(Component));
+                }
+            },
+            [](SparseSet& pool, std::istream& stream) {
+                if constexpr (!ComponentSparseSet<Component>::IS_TAG)
+                {
+                    return ReadBytes(
+                        stream,
+                        Cast<Component>(pool).Components(),
+                        pool.Size() * sizeof(Component));
+                }
+                else
+                {
+                    return true;
+                }
+            });
+    }
+
+    template <typename Component>
+    void Register(
+        std::string_view name,
+        SaveFunction<Component>&& save,
+        LoadFunction<Component>&& load)
+    {
+        static_assert(!ComponentSparseSet<Component>::IS_TAG);
+
+        Add<Component>(
+            name,
+            [save = std::move(save)](
+                const SparseSet& pool,
+                std::ostream& stream) {
+                for (const Component& component : Cast<Component>(pool))
+                {
+                    save(stream, component);
+                }
+            },
+            [load = std::move(load)](SparseSet& pool, std::istream& stream) {
+                Component* components{ Cast<Component>(pool).Components() };
+                for (std::size_t i{ 0 }; i < pool.Size() && stream; ++i)
+                {
+                    load(stream, components[i]);
+                }
+
+                return static_cast<bool>(stream);
+            });
+    }
+
+    // Writes every entity and the pools of the registered components.
+    bool Save(const Registry& registry, std::ostream& stream) const;
+
+    // Replaces the content of the registry. Loaded components are stamped
+    // with the current tick. On failure the registry is left empty.
+    bool Load(Registry& registry, std::istream& stream) const;
+
+    std::size_t Size() const;
+
+private:
+    struct Entry
+    {
+        Hash name;
+        Family family;
+        SparseSet* (*assure)(Registry& registry);
+        std::function<void(const SparseSet&, std::ostream&)> save;
+        std::function<bool(SparseSet&, std::istream&)> load;
+        void (*assign)(SparseSet& pool, std::vector<Entity>&& entities);
+        void (*publish)(SparseSet& pool);
+    };
+
+    template <typename Component>
+    static const ComponentSparseSet<Component>& Cast(const SparseSet& pool)
+    {
+        return static_cast<const ComponentSparseSet<Component>&>(pool);
+    }
+
+    template <typename Component>
+    static ComponentSparseSet<Component>& Cast(SparseSet& pool)
+    {
+        return static_cast<ComponentSparseSet<Component>&>(pool);
+    }
+
+    template <typename Component, typename Save, typename Load>
+    void Add(std::string_view name, Save&& save, Load&& load)
+    {
+        const Hash hash{ Hasher::Digest(name.data(), name.size()) };
+
+        assert(Find(hash) == nullptr && "Component name is registered");
+
+        m_entries.push_back({
+            .name = hash,
+            .family = FamilyId::Type<Component>(),
+            .assure = [](Registry& registry) -> SparseSet* {
+                return registry.GetPool<Component>();
+            },
+            .save = std::forward<Save>(save),
+            .load = std::forward<Load>(load),
+            .assign =
+                [](SparseSet& pool, std::vector<Entity>&& entities) {
+                    Cast<Component>(pool).Assign(std::move(entities));
+                },
+            .publish =
+                [](SparseSet& pool) {
+                    Cast<Component>(pool).PublishAssigned();
+                },
+        });
+    }
+
+    const Entry* Find(Hash name) const;
+
+    static void WriteBytes(
+        std::ostream& stream,
+        const void* data,
+        std::size_t size);
+    static bool ReadBytes(std::istream& stream, void* data, std::size_t size);
+    // Bytes left to read, the maximum when the stream cannot seek.
+    static std::size_t Remaining(std::istream& stream);
+
+private:
+    std::vector<Entry> m_entries;
+};
+}
@@ -2,13 +2,22 @@
 
 #include "Entity.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include <utility>
+#include <vector>
 
 namespace Zeus::ECS
 {
-SparseSet::SparseSet(std::size_t maxEntity) : m_sparse{}, m_dense{}, m_size{ 0 }
+SparseSet::SparseSet(
+    std::size_t maxEntity,
+    std::pmr::memory_resource* resource)
+    : m_sparse{},
+      m_dense{ resource },
+      m_size{ 0 }
 {
     if (maxEntity > 0)
         Reserve(maxEntity);
@@ -37,14 +46,8 @@ void SparseSet::Push(Entity entity)
 {
     assert(!Contains(entity) && "Set contains entity");
 
-    if (entity >= m_sparse.size())
-    {
-        const auto page{ (entity / SPARSE_PAGE_SIZE) + 1u };
-        m_sparse.resize(page * SPARSE_PAGE_SIZE);
-    }
-
     m_dense.push_back(entity);
-    m_sparse[entity] = static_cast<Entity>(m_size);
+    AssureSparseEntry(entity) = static_cast<Entity>(m_size);
 
     ++m_size;
 }
@@ -53,28 +56,79 @@ void SparseSet::Pop(Entity entity)
 {
     assert(Contains(entity) && "Set does not contain entity");
 
-    m_dense[m_sparse[entity]] = m_dense[m_size - 1];
-    m_sparse[m_dense[m_size - 1]] = m_sparse[entity];
+    const auto position{ *SparseEntry(entity) };
+    const auto last{ m_dense[m_size - 1] };
+
+    m_dense[position] = last;
+    AssureSparseEntry(last) = position;
 
     m_dense.pop_back();
     --m_size;
 }
 
+void SparseSet::PopMany(const Entity* first, const Entity* last)
+{
+    for (; first != last; ++first)
+    {
+        if (Contains(*first))
+            Pop(*first);
+    }
+}
+
+bool SparseSet::IsCloneable() const
+{
+    return true;
+}
+
+void SparseSet::CloneMany(
+    [[maybe_unused]] const Entity source,
+    const Entity* first,
+    const Entity* last)
+{
+    assert(Contains(source) && "Set does not contain entity");
+
+    const auto count{ static_cast<std::size_t>(last - first) };
+    if (m_size + count > m_dense.capacity())
+        Reserve(m_size + count);
+
+    for (; first != last; ++first)
+        Push(*first);
+}
+
+void SparseSet::Assign(std::vector<Entity>&& entities)
+{
+    m_dense.assign(entities.begin(), entities.end());
+    m_size = m_dense.size();
+
+    for (std::size_t i{ 0 }; i < m_size; ++i)
+    {
+        AssureSparseEntry(m_dense[i]) = static_cast<Entity>(i);
+    }
+}
+
+void SparseSet::Swap(std::size_t lhs, std::size_t rhs)
+{
+    assert(lhs < m_size && rhs < m_size && "Invalid position");
+
+    std::swap(m_dense[lhs], m_dense[rhs]);
+    AssureSparseEntry(m_dense[lhs]) = static_cast<Entity>(lhs);
+    AssureSparseEntry(m_dense[rhs]) = static_cast<Entity>(rhs);
+}
+
 std::size_t SparseSet::Index(const Entity entity) const
 {
     assert(Contains(entity) && "Set does not contain entity");
 
-    return m_sparse[entity];
+    return *SparseEntry(entity);
 }
 
+// Dense stores the full handle, a stale version fails the last comparison.
 bool SparseSet::Contains(const Entity entity) const
 {
-    assert(
-        entity >= 0 && entity < std::numeric_limits<Entity>::max() &&
-        "Entity is out of bounds");
+    const Entity* position{ SparseEntry(entity) };
 
-    return entity < m_sparse.size() && m_sparse[entity] >= 0 &&
-           m_sparse[entity] < m_size && m_dense[m_sparse[entity]] == entity;
+    return position != nullptr && *position < m_size &&
+           m_dense[*position] == entity;
 }
 
 void SparseSet::Reserve(std::size_t capacity)
@@ -85,6 +139,7 @@ void SparseSet::Reserve(std::size_t capacity)
 
 void SparseSet::Clear()
 {
+    m_dense.clear();
     m_size = 0;
 }
 
@@ -93,6 +148,14 @@ std::size_t SparseSet::Capacity() const
     return m_dense.capacity();
 }
 
+std::size_t SparseSet::PageCount() const
+{
+    return static_cast<std::size_t>(std::count_if(
+        m_sparse.begin(),
+        m_sparse.end(),
+        [](const auto& page) { return page != nullptr; }));
+}
+
 bool SparseSet::Empty() const
 {
     return m_size == 0;
@@ -117,4 +180,29 @@ std::size_t SparseSet::Size() const
 {
     return iterator(m_dense, m_size);
 }
+
+const Entity* SparseSet::SparseEntry(const Entity entity) const
+{
+    const auto index{ entityIndex(entity) };
+    const auto page{ index / SPARSE_PAGE_SIZE };
+
+    if (page >= m_sparse.size() || m_sparse[page] == nullptr)
+        return nullptr;
+
+    return &m_sparse[page][index & (SPARSE_PAGE_SIZE - 1u)];
+}
+
+Entity& SparseSet::AssureSparseEntry(const Entity entity)
+{
+    const auto index{ entityIndex(entity) };
+    const auto page{ index / SPARSE_PAGE_SIZE };
+
+    if (page >= m_sparse.size())
+        m_sparse.resize(page + 1u);
+
+    if (m_sparse[page] == nullptr)
+        m_sparse[page] = std::make_unique<Entity[]>(SPARSE_PAGE_SIZE);
+
+    return m_sparse[page][index & (SPARSE_PAGE_SIZE - 1u)];
+}
 }
@@ -5,6 +5,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace Zeus::ECS
@@ -12,13 +14,16 @@ namespace Zeus::ECS
 class SparseSet
 {
 private:
-    using Container = std::vector<Entity>;
+    using Container = std::pmr::vector<Entity>;
 
 public:
     using size_type = typename Container::size_type;
     using iterator = SparseSetIterator<Container>;
 
-    SparseSet(std::size_t maxEntity = 0);
+    // The dense array is allocated from the resource.
+    SparseSet(
+        std::size_t maxEntity = 0,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     SparseSet(SparseSet&& other) noexcept;
 
     virtual ~SparseSet() = default;
@@ -31,12 +36,31 @@ public:
     virtual void Push(Entity entity);
     virtual void Pop(Entity entity);
 
+    // Pops the entities the set contains, others are skipped.
+    virtual void PopMany(const Entity* first, const Entity* last);
+
+    // Whether CloneMany can copy what an entity holds.
+    virtual bool IsCloneable() const;
+
+    // Pushes the entities with a copy of what the source holds.
+    virtual void CloneMany(
+        const Entity source,
+        const Entity* first,
+        const Entity* last);
+
+    // Replaces the content with the entities, in the given order.
+    void Assign(std::vector<Entity>&& entities);
+
+    // Exchanges two dense positions, sparse entries follow.
+    virtual void Swap(std::size_t lhs, std::size_t rhs);
+
     std::size_t Index(const Entity entity) const;
     bool Contains(const Entity entity) const;
     virtual void Reserve(std::size_t capacity);
-    void Clear();
+    virtual void Clear();
 
     std::size_t Capacity() const;
+    std::size_t PageCount() const;
     bool Empty() const;
     const Entity* Data() const;
     std::size_t Size() const;
@@ -47,8 +71,15 @@ public:
 
 private:
     static constexpr size_type SPARSE_PAGE_SIZE{ 4096 };
+    static_assert((SPARSE_PAGE_SIZE & (SPARSE_PAGE_SIZE - 1)) == 0);
+
+    // Null when the page has not been touched yet.
+    const Entity* SparseEntry(const Entity entity) const;
+    Entity& AssureSparseEntry(const Entity entity);
 
-    Container m_sparse;
+    // Pages are allocated on first touch, memory follows occupancy rather
+    // than the highest entity index.
+    std::vector<std::unique_ptr<Entity[]>> m_sparse;
     Container m_dense;
     size_type m_size;
 };
@@ -0,0 +1,180 @@
+#include "SystemScheduler.hpp"
+
+#include "FamilyId.hpp"
+#include "Registry.hpp"
+#include "core/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+namespace
+{
+bool intersects(
+    const std::vector<Family>& families,
+    const std::vector<Family>& others)
+{
+    return std::any_of(
+        families.begin(),
+        families.end(),
+        [&others](Family family) {
+            return std::find(others.begin(), others.end(), family) !=
+                   others.end();
+        });
+}
+}
+
+SystemScheduler::SystemScheduler()
+    : m_nodes{},
+      m_pending{},
+      m_registry{ nullptr },
+      m_counter{ nullptr }
+{
+}
+
+void SystemScheduler::Run(Registry& registry)
+{
+    assert(m_registry == nullptr && "Scheduler is already running");
+
+    if (m_nodes.empty())
+        return;
+
+    // Pools are created lazily, which is not safe once systems run in
+    // parallel.
+    for (const Node& node : m_nodes)
+    {
+        node.assure(registry);
+    }
+
+    if (m_pending.size() != m_nodes.size())
+        m_pending = std::vector<std::atomic<std::uint32_t>>(m_nodes.size());
+
+    for (std::size_t i{ 0 }; i < m_nodes.size(); ++i)
+    {
+        m_pending[i].store(m_nodes[i].dependencies, std::memory_order_relaxed);
+    }
+
+    JobCounter counter;
+    m_registry = &registry;
+    m_counter = &counter;
+
+    for (std::size_t i{ 0 }; i < m_nodes.size(); ++i)
+    {
+        if (m_nodes[i].dependencies > 0)
+            continue;
+
+        const auto index{ static_cast<std::uint32_t>(i) };
+        JobSystem::Execute(Job{
+            .function = RunNode,
+            .data = this,
+            .begin = index,
+            .end = index + 1u,
+            .counter = &counter,
+        });
+    }
+
+    JobSystem::Wait(counter);
+
+    m_registry = nullptr;
+    m_counter = nullptr;
+}
+
+void SystemScheduler::Clear()
+{
+    assert(m_registry == nullptr && "Scheduler is running");
+
+    m_nodes.clear();
+    m_pending.clear();
+}
+
+std::size_t SystemScheduler::Size() const
+{
+    return m_nodes.size();
+}
+
+bool SystemScheduler::DependsOn(std::size_t system, std::size_t other) const
+{
+    assert(system < m_nodes.size() && other < m_nodes.size());
+
+    const std::vector<std::size_t>& successors{ m_nodes[other].successors };
+    return std::find(successors.begin(), successors.end(), system) !=
+           successors.end();
+}
+
+std::size_t SystemScheduler::Add(
+    System&& system,
+    std::vector<Family>&& reads,
+    std::vector<Family>&& writes,
+    void (*assure)(Registry& registry))
+{
+    assert(m_registry == nullptr && "Scheduler is running");
+
+    Node node{
+        .system = std::move(system),
+        .assure = assure,
+        .reads = std::move(reads),
+        .writes = std::move(writes),
+        .successors = {},
+        .dependencies = 0,
+    };
+
+    const std::size_t index{ m_nodes.size() };
+
+    // Earlier systems win conflicts so that results do not depend on timing.
+    for (std::size_t i{ 0 }; i < index; ++i)
+    {
+        if (!Conflicts(node, m_nodes[i]))
+            continue;
+
+        m_nodes[i].successors.push_back(index);
+        ++node.dependencies;
+    }
+
+    m_nodes.push_back(std::move(node));
+
+    return index;
+}
+
+bool SystemScheduler::Conflicts(const Node& node, const Node& other)
+{
+    return intersects(node.writes, other.writes) ||
+           intersects(node.writes, other.reads) ||
+           intersects(node.reads, other.writes);
+}
+
+void SystemScheduler::RunNode(
+    void* data,
+    std::uint32_t begin,
+    [[maybe_unused]] std::uint32_t end)
+{
+    auto& scheduler{ *static_cast<SystemScheduler*>(data) };
+    const Node& node{ scheduler.m_nodes[begin] };
+
+    node.system(*scheduler.m_registry);
+
+    // Successors are queued before this job completes, the frame counter
+    // cannot reach zero while systems are outstanding.
+    for (const std::size_t successor : node.successors)
+    {
+        if (scheduler.m_pending[successor].fetch_sub(
+                1,
+                std::memory_order_acq_rel) != 1u)
+            continue;
+
+        const auto index{ static_cast<std::uint32_t>(successor) };
+        JobSystem::Execute(Job{
+            .function = RunNode,
+            .data = &scheduler,
+            .begin = index,
+            .end = index + 1u,
+            .counter = scheduler.m_counter,
+        });
+    }
+}
+}
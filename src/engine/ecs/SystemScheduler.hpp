@@ -0,0 +1,108 @@
+#pragma once
+
+#include "FamilyId.hpp"
+#include "Registry.hpp"
+#include "core/JobSystem.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Zeus::ECS
+{
+template <typename... Components>
+struct Read
+{
+};
+
+template <typename... Components>
+struct Write
+{
+};
+
+// Runs systems on the job system. Every system declares the components it
+// reads and writes, systems without conflicting access run concurrently and
+// conflicting ones in registration order.
+// Systems must only touch their declared components, structural changes
+// (Create/Emplace/Erase/Destroy) are not allowed while Run is in progress.
+class SystemScheduler
+{
+public:
+    using System = std::function<void(Registry&)>;
+
+    SystemScheduler();
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    template <typename Reads = Read<>, typename Writes = Write<>>
+    std::size_t Add(System&& system)
+    {
+        return Add(
+            std::move(system),
+            Access<Reads>::Families(),
+            Access<Writes>::Families(),
+            [](Registry& registry) {
+                Access<Reads>::Assure(registry);
+                Access<Writes>::Assure(registry);
+            });
+    }
+
+    // Blocks until every system has finished.
+    void Run(Registry& registry);
+
+    void Clear();
+
+    std::size_t Size() const;
+
+    // Whether the system waits directly on the other one.
+    bool DependsOn(std::size_t system, std::size_t other) const;
+
+private:
+    template <typename List>
+    struct Access;
+
+    template <template <typename...> typename List, typename... Components>
+    struct Access<List<Components...>>
+    {
+        static std::vector<Family> Families()
+        {
+            return { FamilyId::Type<Components>()... };
+        }
+
+        static void Assure(Registry& registry)
+        {
+            if constexpr (sizeof...(Components) > 0)
+                registry.Assure<Components...>();
+        }
+    };
+
+    struct Node
+    {
+        System system;
+        void (*assure)(Registry& registry);
+        std::vector<Family> reads;
+        std::vector<Family> writes;
+        std::vector<std::size_t> successors;
+        std::uint32_t dependencies;
+    };
+
+    std::size_t Add(
+        System&& system,
+        std::vector<Family>&& reads,
+        std::vector<Family>&& writes,
+        void (*assure)(Registry& registry));
+
+    static bool Conflicts(const Node& node, const Node& other);
+    static void RunNode(void* data, std::uint32_t begin, std::uint32_t end);
+
+private:
+    std::vector<Node> m_nodes;
+    std::vector<std::atomic<std::uint32_t>> m_pending;
+    Registry* m_registry;
+    JobCounter* m_counter;
+};
+}
@@ -2,6 +2,7 @@
 
 #include "EventHandler.hpp"
 
+#include <memory_resource>
 #include <tuple>
 #include <vector>
 
@@ -19,13 +20,20 @@ private:
     };
 
     template <typename EventType>
-    using EventHandlerPool = std::vector<RegisteredEventHandler<EventType>>;
+    using EventHandlerPool =
+        std::pmr::vector<RegisteredEventHandler<EventType>>;
 
     template <typename EventType>
-    using EventPool = std::vector<EventType>;
+    using EventPool = std::pmr::vector<EventType>;
 
 public:
-    EventQueue(std::uint64_t handlersCapacity, std::uint64_t eventsCapacity)
+    // Handler and event pools are allocated from the resource.
+    EventQueue(
+        std::uint64_t handlersCapacity,
+        std::uint64_t eventsCapacity,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_eventHandlers{ EventHandlerPool<EventTypes>(resource)... },
+          m_eventPools{ EventPool<EventTypes>(resource)... }
     {
         (std::get<EventHandlerPool<EventTypes>>(m_eventHandlers)
              .reserve(handlersCapacity),
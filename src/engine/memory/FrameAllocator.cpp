@@ -0,0 +1,107 @@
+#include "FrameAllocator.hpp"
+
+#include "Allocator.hpp"
+#include "LinearAllocator.hpp"
+#include "memory.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Zeus
+{
+FrameAllocator::FrameAllocator(
+    const std::size_t frameBytes,
+    const std::uint32_t frameCount,
+    void* const start) noexcept
+    : Allocator{ frameBytes * frameCount, start },
+      m_frames{},
+      m_frameIndex{ 0 }
+{
+    assert(frameBytes > 0 && frameCount > 0);
+
+    m_frames.reserve(frameCount);
+    for (std::uint32_t i{ 0 }; i < frameCount; ++i)
+    {
+        m_frames.emplace_back(frameBytes, addPtr(start, i * frameBytes));
+    }
+}
+
+FrameAllocator::FrameAllocator(FrameAllocator&& other) noexcept
+    : Allocator(std::move(other)),
+      m_frames{ std::move(other.m_frames) },
+      m_frameIndex{ other.m_frameIndex }
+{
+    other.m_frameIndex = 0;
+}
+
+FrameAllocator& FrameAllocator::operator=(FrameAllocator&& rhs) noexcept
+{
+    Allocator::operator=(std::move(rhs));
+
+    m_frames = std::move(rhs.m_frames);
+    m_frameIndex = rhs.m_frameIndex;
+
+    rhs.m_frameIndex = 0;
+
+    return *this;
+}
+
+FrameAllocator::~FrameAllocator() noexcept
+{
+    m_numAllocations = 0;
+    m_usedBytes = 0;
+}
+
+void* FrameAllocator::Allocate(
+    const std::size_t& size,
+    const std::uintptr_t& alignment)
+{
+    LinearAllocator& frame{ m_frames[m_frameIndex] };
+    const std::size_t usedBytes{ frame.GetUsedBytes() };
+
+    void* const ptr{ frame.Allocate(size, alignment) };
+
+    if (ptr == nullptr)
+        return nullptr;
+
+    m_usedBytes += frame.GetUsedBytes() - usedBytes;
+    ++m_numAllocations;
+
+    return ptr;
+}
+
+void FrameAllocator::Free([[maybe_unused]] void* const ptr) noexcept
+{
+}
+
+void FrameAllocator::BeginFrame(const std::uint32_t frameIndex) noexcept
+{
+    assert(frameIndex < m_frames.size());
+
+    LinearAllocator& frame{ m_frames[frameIndex] };
+
+    m_usedBytes -= frame.GetUsedBytes();
+    m_numAllocations -= frame.GetNumAllocations();
+    frame.Clear();
+
+    m_frameIndex = frameIndex;
+}
+
+std::uint32_t FrameAllocator::GetFrameIndex() const noexcept
+{
+    return m_frameIndex;
+}
+
+std::uint32_t FrameAllocator::GetFrameCount() const noexcept
+{
+    return static_cast<std::uint32_t>(m_frames.size());
+}
+
+const LinearAllocator& FrameAllocator::GetFrame(
+    const std::uint32_t frameIndex) const
+{
+    return m_frames[frameIndex];
+}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Allocator.hpp"
+#include "LinearAllocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Zeus
+{
+// Linear allocator per frame in flight. Allocations go to the current frame
+// and are released together when the frame comes around again, after its
+// fence signaled. Allocating is a pointer bump and Free does nothing.
+class FrameAllocator : public Allocator
+{
+public:
+    // The memory is split into frameCount regions of frameBytes each.
+    FrameAllocator(
+        const std::size_t frameBytes,
+        const std::uint32_t frameCount,
+        void* const start) noexcept;
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+    FrameAllocator(FrameAllocator&&) noexcept;
+    FrameAllocator& operator=(FrameAllocator&&) noexcept;
+
+    virtual ~FrameAllocator() noexcept;
+
+    // Returns nullptr when the remaining memory is too small.
+    virtual void* Allocate(
+        const std::size_t& size,
+        const std::uintptr_t& alignment = sizeof(std::intptr_t)) override;
+
+    virtual void Free(void* const ptr) noexcept override final;
+
+    // Makes the frame current and clears what it allocated the last time it
+    // was current. The GPU must be done with that memory.
+    void BeginFrame(const std::uint32_t frameIndex) noexcept;
+
+    std::uint32_t GetFrameIndex() const noexcept;
+    std::uint32_t GetFrameCount() const noexcept;
+    const LinearAllocator& GetFrame(const std::uint32_t frameIndex) const;
+
+private:
+    std::vector<LinearAllocator> m_frames;
+    std::uint32_t m_frameIndex;
+};
+}
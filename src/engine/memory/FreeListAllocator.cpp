@@ -95,7 +95,8 @@ void* FreeListAllocator::Allocate(
         freeBlock = freeBlock->next;
     }
 
-    assert(bestFit != nullptr);
+    if (bestFit == nullptr)
+        return nullptr;
 
     if (bestFit->size - bestFitTotalSize <= sizeof(AllocationHeader))
     {
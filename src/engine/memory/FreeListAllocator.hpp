@@ -20,6 +20,7 @@ public:
 
     virtual ~FreeListAllocator() noexcept;
 
+    // Returns nullptr when the remaining memory is too small.
     virtual void* Allocate(
         const std::size_t& size,
         const std::uintptr_t& alignment = sizeof(std::uintptr_t)) override;
@@ -49,7 +49,8 @@ void* LinearAllocator::Allocate(
 
     std::size_t adjustment{ alignForwardAdjustment(m_current, alignment) };
 
-    assert(m_usedBytes + adjustment + size <= m_size);
+    if (m_usedBytes + adjustment + size > m_size)
+        return nullptr;
 
     void* alignedAddr{ addPtr(m_current, adjustment) };
 
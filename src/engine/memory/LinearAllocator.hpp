@@ -18,6 +18,7 @@ public:
 
     virtual ~LinearAllocator() noexcept;
 
+    // Returns nullptr when the remaining memory is too small.
     virtual void* Allocate(
         const std::size_t& size,
         const std::uintptr_t& alignment = sizeof(std::intptr_t)) override;
@@ -0,0 +1,50 @@
+#include "MemoryResource.hpp"
+
+#include "Allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace Zeus
+{
+MemoryResource::MemoryResource(Allocator& allocator) noexcept
+    : m_allocator{ allocator }
+{
+}
+
+Allocator& MemoryResource::GetAllocator() const noexcept
+{
+    return m_allocator;
+}
+
+void* MemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // Allocators expect a non zero size.
+    void* const ptr{ m_allocator.Allocate(
+        bytes > 0 ? bytes : 1,
+        static_cast<std::uintptr_t>(alignment)) };
+
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void MemoryResource::do_deallocate(
+    void* ptr,
+    [[maybe_unused]] std::size_t bytes,
+    [[maybe_unused]] std::size_t alignment)
+{
+    m_allocator.Free(ptr);
+}
+
+bool MemoryResource::do_is_equal(
+    const std::pmr::memory_resource& other) const noexcept
+{
+    const auto* resource{ dynamic_cast<const MemoryResource*>(&other) };
+
+    return resource != nullptr && &resource->m_allocator == &m_allocator;
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Allocator.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace Zeus
+{
+// Exposes an Allocator as a std::pmr::memory_resource, so standard pmr
+// containers draw from engine allocators. The allocator has to outlive the
+// resource and every container using it. Allocators which do not free
+// individually, like LinearAllocator, keep the memory of grown containers
+// until they are cleared.
+class MemoryResource : public std::pmr::memory_resource
+{
+public:
+    explicit MemoryResource(Allocator& allocator) noexcept;
+
+    Allocator& GetAllocator() const noexcept;
+
+private:
+    // Throws std::bad_alloc when the allocator returns nullptr.
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+        override;
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override;
+
+    Allocator& m_allocator;
+};
+}
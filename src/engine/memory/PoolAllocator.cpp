@@ -0,0 +1,206 @@
+#include "PoolAllocator.hpp"
+
+#include "Allocator.hpp"
+#include "memory.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace Zeus
+{
+PoolAllocator::PoolAllocator(
+    const std::size_t slotSize,
+    const std::size_t slotAlignment,
+    const std::size_t sizeBytes,
+    void* const start,
+    const PoolGrowth growth) noexcept
+    : Allocator{ sizeBytes, start },
+      m_slotAlignment{ std::max(slotAlignment, alignof(FreeSlot)) },
+      m_slotCount{ 0 },
+      m_growth{ growth },
+      m_freeSlots{ nullptr },
+      m_chunks{ nullptr }
+{
+    assert(slotSize > 0 && isPowerOf2(slotAlignment));
+
+    // Free slots hold the link to the next one.
+    m_slotSize = alignUp(std::max(slotSize, sizeof(FreeSlot)), m_slotAlignment);
+    m_blockSize = std::max(
+        sizeBytes,
+        alignUp(sizeof(Chunk), m_slotAlignment) + m_slotSize);
+
+    Carve(start, sizeBytes);
+}
+
+PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept
+    : Allocator(std::move(other)),
+      m_slotSize{ other.m_slotSize },
+      m_slotAlignment{ other.m_slotAlignment },
+      m_slotCount{ other.m_slotCount },
+      m_blockSize{ other.m_blockSize },
+      m_growth{ other.m_growth },
+      m_freeSlots{ other.m_freeSlots },
+      m_chunks{ other.m_chunks }
+{
+    other.m_slotCount = 0;
+    other.m_freeSlots = nullptr;
+    other.m_chunks = nullptr;
+}
+
+PoolAllocator& PoolAllocator::operator=(PoolAllocator&& rhs) noexcept
+{
+    if (this == &rhs)
+        return *this;
+
+    ReleaseChunks();
+
+    Allocator::operator=(std::move(rhs));
+
+    m_slotSize = rhs.m_slotSize;
+    m_slotAlignment = rhs.m_slotAlignment;
+    m_slotCount = rhs.m_slotCount;
+    m_blockSize = rhs.m_blockSize;
+    m_growth = rhs.m_growth;
+    m_freeSlots = rhs.m_freeSlots;
+    m_chunks = rhs.m_chunks;
+
+    rhs.m_slotCount = 0;
+    rhs.m_freeSlots = nullptr;
+    rhs.m_chunks = nullptr;
+
+    return *this;
+}
+
+PoolAllocator::~PoolAllocator() noexcept
+{
+    ReleaseChunks();
+
+    m_freeSlots = nullptr;
+    m_numAllocations = 0;
+    m_usedBytes = 0;
+}
+
+void* PoolAllocator::Allocate(
+    [[maybe_unused]] const std::size_t& size,
+    [[maybe_unused]] const std::uintptr_t& alignment)
+{
+    assert(size > 0 && size <= m_slotSize);
+    assert(alignment > 0 && alignment <= m_slotAlignment);
+
+    if (m_freeSlots == nullptr &&
+        (m_growth == PoolGrowth::Fixed || !Grow()))
+    {
+        return nullptr;
+    }
+
+    FreeSlot* slot{ m_freeSlots };
+    m_freeSlots = slot->next;
+
+#ifndef NDEBUG
+    const auto* bytes{ reinterpret_cast<const std::uint8_t*>(slot) };
+    for (std::size_t i{ sizeof(FreeSlot) }; i < m_slotSize; ++i)
+    {
+        assert(bytes[i] == POISON && "Slot was written after Free");
+    }
+#endif
+
+    m_usedBytes += m_slotSize;
+    ++m_numAllocations;
+
+    return slot;
+}
+
+void PoolAllocator::Free(void* const ptr) noexcept
+{
+    assert(ptr != nullptr);
+
+    Poison(ptr);
+
+    FreeSlot* slot{ reinterpret_cast<FreeSlot*>(ptr) };
+    slot->next = m_freeSlots;
+    m_freeSlots = slot;
+
+    m_usedBytes -= m_slotSize;
+    --m_numAllocations;
+}
+
+std::size_t PoolAllocator::GetSlotSize() const noexcept
+{
+    return m_slotSize;
+}
+
+std::size_t PoolAllocator::GetSlotCount() const noexcept
+{
+    return m_slotCount;
+}
+
+void PoolAllocator::Carve(
+    void* const start,
+    const std::size_t sizeBytes) noexcept
+{
+    const std::size_t adjustment{ alignForwardAdjustment(
+        start,
+        m_slotAlignment) };
+
+    if (sizeBytes <= adjustment)
+        return;
+
+    const std::size_t count{ (sizeBytes - adjustment) / m_slotSize };
+    void* const first{ addPtr(start, adjustment) };
+
+    for (std::size_t i{ count }; i > 0; --i)
+    {
+        void* const slot{ addPtr(first, (i - 1) * m_slotSize) };
+        Poison(slot);
+
+        reinterpret_cast<FreeSlot*>(slot)->next = m_freeSlots;
+        m_freeSlots = reinterpret_cast<FreeSlot*>(slot);
+    }
+
+    m_slotCount += count;
+}
+
+bool PoolAllocator::Grow()
+{
+    void* const memory{ ::operator new(
+        m_blockSize,
+        std::align_val_t{ m_slotAlignment },
+        std::nothrow) };
+
+    if (memory == nullptr)
+        return false;
+
+    Chunk* chunk{ reinterpret_cast<Chunk*>(memory) };
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+
+    const std::size_t header{ alignUp(sizeof(Chunk), m_slotAlignment) };
+    Carve(addPtr(memory, header), m_blockSize - header);
+
+    m_size += m_blockSize;
+
+    return true;
+}
+
+void PoolAllocator::ReleaseChunks() noexcept
+{
+    while (m_chunks != nullptr)
+    {
+        Chunk* next{ m_chunks->next };
+        ::operator delete(m_chunks, std::align_val_t{ m_slotAlignment });
+        m_chunks = next;
+    }
+}
+
+void PoolAllocator::Poison([[maybe_unused]] void* const slot) const noexcept
+{
+#ifndef NDEBUG
+    std::memset(slot, POISON, m_slotSize);
+#endif
+}
+}
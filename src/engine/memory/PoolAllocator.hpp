@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zeus
+{
+enum class PoolGrowth : std::uint8_t
+{
+    // Allocate returns nullptr once every slot is taken.
+    Fixed,
+    // Another block of the initial size is taken from the heap and chained
+    // to the pool when it runs out. Slots never move.
+    Chained,
+};
+
+// Carves memory into equal slots threaded on an intrusive free list.
+// Allocate and Free pop and push a slot, there is no per allocation header.
+// Debug builds fill free slots with POISON and check it is intact when the
+// slot is handed out again, catching writes through dangling pointers.
+class PoolAllocator : public Allocator
+{
+public:
+    static constexpr std::uint8_t POISON{ 0xDD };
+
+    PoolAllocator(
+        const std::size_t slotSize,
+        const std::size_t slotAlignment,
+        const std::size_t sizeBytes,
+        void* const start,
+        const PoolGrowth growth = PoolGrowth::Fixed) noexcept;
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+    PoolAllocator(PoolAllocator&&) noexcept;
+    PoolAllocator& operator=(PoolAllocator&&) noexcept;
+
+    virtual ~PoolAllocator() noexcept;
+
+    // Size and alignment must fit the slot.
+    virtual void* Allocate(
+        const std::size_t& size,
+        const std::uintptr_t& alignment = sizeof(std::uintptr_t)) override;
+
+    virtual void Free(void* const ptr) noexcept override final;
+
+    // Distance between slots, the slot size rounded up to the alignment.
+    std::size_t GetSlotSize() const noexcept;
+    std::size_t GetSlotCount() const noexcept;
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    // Header of every block added by growth.
+    struct Chunk
+    {
+        Chunk* next;
+    };
+
+    // Pushes the slots fitting in the memory, lowest address on top.
+    void Carve(void* const start, const std::size_t sizeBytes) noexcept;
+    bool Grow();
+    // Returns the blocks added by growth to the heap.
+    void ReleaseChunks() noexcept;
+
+    void Poison(void* const slot) const noexcept;
+
+    std::size_t m_slotSize;
+    std::size_t m_slotAlignment;
+    std::size_t m_slotCount;
+    std::size_t m_blockSize; // size of the blocks added by growth
+    PoolGrowth m_growth;
+
+    FreeSlot* m_freeSlots;
+    Chunk* m_chunks;
+};
+}
@@ -0,0 +1,75 @@
+#include "ScratchScope.hpp"
+
+#include "LinearAllocator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Zeus
+{
+namespace
+{
+struct ThreadArena
+{
+    ThreadArena()
+        : memory{ std::make_unique_for_overwrite<std::byte[]>(
+              ScratchScope::ARENA_SIZE) },
+          allocator{ ScratchScope::ARENA_SIZE, memory.get() }
+    {
+    }
+
+    std::unique_ptr<std::byte[]> memory;
+    LinearAllocator allocator;
+    std::size_t highWaterMark{ 0 };
+    std::uint32_t depth{ 0 };
+};
+
+thread_local ThreadArena t_arena{};
+}
+
+ScratchScope::ScratchScope() noexcept
+    : m_arena{ t_arena.allocator },
+      m_mark{ const_cast<void*>(t_arena.allocator.GetCurrent()) },
+      m_depth{ ++t_arena.depth }
+{
+}
+
+ScratchScope::~ScratchScope() noexcept
+{
+    assert(m_depth == t_arena.depth && "Scratch scopes must end in order");
+
+    m_arena.Rewind(m_mark);
+    --t_arena.depth;
+}
+
+void* ScratchScope::Allocate(
+    const std::size_t& size,
+    const std::uintptr_t& alignment)
+{
+    assert(m_depth == t_arena.depth && "Allocate from the innermost scope");
+
+    void* const ptr{ m_arena.Allocate(size, alignment) };
+    t_arena.highWaterMark =
+        std::max(t_arena.highWaterMark, m_arena.GetUsedBytes());
+
+    return ptr;
+}
+
+const LinearAllocator& ScratchScope::Arena()
+{
+    return t_arena.allocator;
+}
+
+std::size_t ScratchScope::HighWaterMark()
+{
+    return t_arena.highWaterMark;
+}
+
+void ScratchScope::ResetHighWaterMark()
+{
+    t_arena.highWaterMark = t_arena.allocator.GetUsedBytes();
+}
+}
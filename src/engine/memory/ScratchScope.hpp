@@ -0,0 +1,46 @@
+#pragma once
+
+#include "LinearAllocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Zeus
+{
+// Temporary memory from the scratch arena of the calling thread, a
+// LinearAllocator created on first use. Everything allocated through the
+// scope is released when it ends, by rewinding the arena to where it was.
+// Scopes nest, allocations have to go through the innermost one.
+class ScratchScope
+{
+public:
+    static constexpr std::size_t ARENA_SIZE{ 4u << 20 };
+
+    ScratchScope() noexcept;
+    ~ScratchScope() noexcept;
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    void* Allocate(
+        const std::size_t& size,
+        const std::uintptr_t& alignment = sizeof(std::intptr_t));
+
+    template <typename T>
+    T* Allocate(const std::size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    static const LinearAllocator& Arena();
+
+    // Most bytes the calling thread had in use at once.
+    static std::size_t HighWaterMark();
+    static void ResetHighWaterMark();
+
+private:
+    LinearAllocator& m_arena;
+    void* m_mark;
+    std::uint32_t m_depth;
+};
+}
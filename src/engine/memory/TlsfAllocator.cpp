@@ -0,0 +1,284 @@
+#include "TlsfAllocator.hpp"
+
+#include "Allocator.hpp"
+#include "memory.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace Zeus
+{
+TlsfAllocator::TlsfAllocator(
+    const std::size_t sizeBytes,
+    void* const start) noexcept
+    : Allocator{ sizeBytes, start },
+      m_flBitmap{ 0 },
+      m_slBitmaps{},
+      m_freeBlocks{},
+      m_end{ nullptr }
+{
+    const std::size_t adjustment{ alignForwardAdjustment(start, ALIGNMENT) };
+    assert(sizeBytes > adjustment + MIN_BLOCK_SIZE);
+
+    const std::size_t size{ alignDown(sizeBytes - adjustment, ALIGNMENT) };
+    assert(size < std::size_t{ 1 } << FL_MAX);
+
+    Block* block{ reinterpret_cast<Block*>(addPtr(start, adjustment)) };
+    block->prevPhysical = nullptr;
+    block->size = size;
+
+    m_end = addPtr(block, size);
+
+    Insert(block);
+}
+
+TlsfAllocator::TlsfAllocator(TlsfAllocator&& other) noexcept
+    : Allocator(std::move(other)),
+      m_flBitmap{ other.m_flBitmap },
+      m_slBitmaps{ other.m_slBitmaps },
+      m_freeBlocks{ other.m_freeBlocks },
+      m_end{ other.m_end }
+{
+    other.m_flBitmap = 0;
+    other.m_slBitmaps = {};
+    other.m_freeBlocks = {};
+    other.m_end = nullptr;
+}
+
+TlsfAllocator& TlsfAllocator::operator=(TlsfAllocator&& rhs) noexcept
+{
+    Allocator::operator=(std::move(rhs));
+
+    m_flBitmap = rhs.m_flBitmap;
+    m_slBitmaps = rhs.m_slBitmaps;
+    m_freeBlocks = rhs.m_freeBlocks;
+    m_end = rhs.m_end;
+
+    rhs.m_flBitmap = 0;
+    rhs.m_slBitmaps = {};
+    rhs.m_freeBlocks = {};
+    rhs.m_end = nullptr;
+
+    return *this;
+}
+
+TlsfAllocator::~TlsfAllocator() noexcept
+{
+    m_numAllocations = 0;
+    m_usedBytes = 0;
+}
+
+void* TlsfAllocator::Allocate(
+    const std::size_t& size,
+    const std::uintptr_t& alignment)
+{
+    assert(size > 0 && alignment > 0);
+    assert(isPowerOf2(alignment));
+
+    const std::size_t blockSize{ std::max(
+        alignUp(size, ALIGNMENT) + HEADER_SIZE,
+        MIN_BLOCK_SIZE) };
+
+    // A stricter alignment moves the payload forward, the skipped bytes
+    // become a free block of their own and need room for its header.
+    const std::size_t padding{ alignment > ALIGNMENT
+                                   ? alignment + MIN_BLOCK_SIZE
+                                   : 0 };
+
+    Block* block{ FindFree(blockSize + padding) };
+    if (block == nullptr)
+        return nullptr;
+
+    Remove(block);
+
+    if (padding > 0)
+    {
+        const auto payload{ reinterpret_cast<std::uintptr_t>(block) +
+                            HEADER_SIZE };
+
+        std::uintptr_t gap{ alignUp(payload, alignment) - payload };
+        if (gap != 0 && gap < MIN_BLOCK_SIZE)
+            gap = alignUp(payload + MIN_BLOCK_SIZE, alignment) - payload;
+
+        if (gap != 0)
+        {
+            Block* aligned{ reinterpret_cast<Block*>(addPtr(block, gap)) };
+            aligned->prevPhysical = block;
+            aligned->size = block->size - gap;
+
+            if (Block* next{ NextPhysical(aligned) }; next != nullptr)
+                next->prevPhysical = aligned;
+
+            // The block was free, its predecessor is in use and the gap
+            // does not need merging.
+            block->size = gap;
+            Insert(block);
+
+            block = aligned;
+        }
+    }
+
+    Split(block, blockSize);
+
+    m_usedBytes += block->size;
+    ++m_numAllocations;
+
+    return addPtr(block, HEADER_SIZE);
+}
+
+void TlsfAllocator::Free(void* const ptr) noexcept
+{
+    assert(ptr != nullptr);
+
+    Block* block{ reinterpret_cast<Block*>(subPtr(ptr, HEADER_SIZE)) };
+    assert(!IsFree(block));
+
+    m_usedBytes -= block->size;
+    --m_numAllocations;
+
+    if (Block* prev{ block->prevPhysical }; prev != nullptr && IsFree(prev))
+    {
+        Remove(prev);
+        prev->size = SizeOf(prev) + block->size;
+        block = prev;
+    }
+
+    if (Block* next{ NextPhysical(block) }; next != nullptr && IsFree(next))
+    {
+        Remove(next);
+        block->size += SizeOf(next);
+    }
+
+    if (Block* next{ NextPhysical(block) }; next != nullptr)
+        next->prevPhysical = block;
+
+    Insert(block);
+}
+
+TlsfAllocator::Index TlsfAllocator::Mapping(std::size_t size) noexcept
+{
+    if (size < SMALL_BLOCK_SIZE)
+    {
+        return { .fl = 0,
+                 .sl = static_cast<std::uint32_t>(size / ALIGNMENT) };
+    }
+
+    const auto fls{ static_cast<std::uint32_t>(std::bit_width(size) - 1) };
+
+    return {
+        .fl = fls - FL_SHIFT + 1,
+        .sl = static_cast<std::uint32_t>(size >> (fls - SL_LOG2)) ^ SL_COUNT,
+    };
+}
+
+std::size_t TlsfAllocator::SizeOf(const Block* block) noexcept
+{
+    return block->size & ~FREE_BIT;
+}
+
+bool TlsfAllocator::IsFree(const Block* block) noexcept
+{
+    return (block->size & FREE_BIT) != 0;
+}
+
+TlsfAllocator::Block* TlsfAllocator::FindFree(std::size_t size) noexcept
+{
+    // Rounding up to the next list boundary makes any block of the list
+    // found large enough, the search never walks a list.
+    if (size >= SMALL_BLOCK_SIZE)
+    {
+        const auto fls{ static_cast<std::uint32_t>(std::bit_width(size) - 1) };
+        size += (std::size_t{ 1 } << (fls - SL_LOG2)) - 1;
+    }
+
+    auto [fl, sl]{ Mapping(size) };
+    if (fl >= FL_COUNT)
+        return nullptr;
+
+    std::uint32_t slMap{ m_slBitmaps[fl] & (~0u << sl) };
+    if (slMap == 0)
+    {
+        const std::uint32_t flMap{ m_flBitmap & (~0u << (fl + 1)) };
+        if (flMap == 0)
+            return nullptr;
+
+        fl = static_cast<std::uint32_t>(std::countr_zero(flMap));
+        slMap = m_slBitmaps[fl];
+    }
+
+    sl = static_cast<std::uint32_t>(std::countr_zero(slMap));
+
+    return m_freeBlocks[fl][sl];
+}
+
+void TlsfAllocator::Insert(Block* block) noexcept
+{
+    const auto [fl, sl]{ Mapping(block->size) };
+    Block*& head{ m_freeBlocks[fl][sl] };
+
+    block->size |= FREE_BIT;
+    block->prevFree = nullptr;
+    block->nextFree = head;
+
+    if (head != nullptr)
+        head->prevFree = block;
+
+    head = block;
+
+    m_flBitmap |= 1u << fl;
+    m_slBitmaps[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::Remove(Block* block) noexcept
+{
+    block->size &= ~FREE_BIT;
+
+    const auto [fl, sl]{ Mapping(block->size) };
+
+    if (block->prevFree != nullptr)
+        block->prevFree->nextFree = block->nextFree;
+    else
+        m_freeBlocks[fl][sl] = block->nextFree;
+
+    if (block->nextFree != nullptr)
+        block->nextFree->prevFree = block->prevFree;
+
+    if (m_freeBlocks[fl][sl] == nullptr)
+    {
+        m_slBitmaps[fl] &= ~(1u << sl);
+
+        if (m_slBitmaps[fl] == 0)
+            m_flBitmap &= ~(1u << fl);
+    }
+}
+
+void TlsfAllocator::Split(Block* block, std::size_t size) noexcept
+{
+    if (block->size - size < MIN_BLOCK_SIZE)
+        return;
+
+    Block* rest{ reinterpret_cast<Block*>(addPtr(block, size)) };
+    rest->prevPhysical = block;
+    rest->size = block->size - size;
+
+    if (Block* next{ NextPhysical(rest) }; next != nullptr)
+        next->prevPhysical = rest;
+
+    block->size = size;
+
+    // The successor of a free block is in use, the rest needs no merging.
+    Insert(rest);
+}
+
+TlsfAllocator::Block* TlsfAllocator::NextPhysical(
+    const Block* block) const noexcept
+{
+    void* const next{ addPtr(block, SizeOf(block)) };
+
+    return next != m_end ? reinterpret_cast<Block*>(next) : nullptr;
+}
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Allocator.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Zeus
+{
+// Two-Level Segregated Fit allocator. Free blocks are kept in lists indexed
+// by a power of two range and a linear subdivision of it, two bitmaps find a
+// non-empty list with a couple of bit scans. Allocate and Free run in
+// constant time regardless of fragmentation.
+// Every block starts with a boundary tag linking it to its physical
+// predecessor, freed blocks merge with free neighbours immediately.
+class TlsfAllocator : public Allocator
+{
+public:
+    TlsfAllocator(const std::size_t sizeBytes, void* const start) noexcept;
+
+    TlsfAllocator(const TlsfAllocator&) = delete;
+    TlsfAllocator& operator=(const TlsfAllocator&) = delete;
+    TlsfAllocator(TlsfAllocator&&) noexcept;
+    TlsfAllocator& operator=(TlsfAllocator&&) noexcept;
+
+    virtual ~TlsfAllocator() noexcept;
+
+    // Returns nullptr when no free block is large enough.
+    virtual void* Allocate(
+        const std::size_t& size,
+        const std::uintptr_t& alignment = sizeof(std::uintptr_t)) override;
+
+    virtual void Free(void* const ptr) noexcept override final;
+
+private:
+    struct Block
+    {
+        Block* prevPhysical;
+        std::size_t size; // lowest bit set while the block is free
+
+        // Only valid while the block is free, overlaps the payload.
+        Block* nextFree;
+        Block* prevFree;
+    };
+
+    static constexpr std::size_t ALIGNMENT{ 16 };
+    static constexpr std::size_t HEADER_SIZE{ offsetof(Block, nextFree) };
+    static constexpr std::size_t MIN_BLOCK_SIZE{ sizeof(Block) };
+    static constexpr std::size_t FREE_BIT{ 1 };
+
+    // Every power of two range is split into 2^SL_LOG2 lists. Sizes below
+    // SMALL_BLOCK_SIZE share the first level, one list per ALIGNMENT.
+    static constexpr std::uint32_t SL_LOG2{ 4 };
+    static constexpr std::uint32_t SL_COUNT{ 1u << SL_LOG2 };
+    static constexpr std::uint32_t FL_SHIFT{ SL_LOG2 + 4 };
+    static constexpr std::size_t SMALL_BLOCK_SIZE{ std::size_t{ 1 }
+                                                   << FL_SHIFT };
+    static constexpr std::uint32_t FL_MAX{ 32 };
+    static constexpr std::uint32_t FL_COUNT{ FL_MAX - FL_SHIFT + 1 };
+
+    static_assert(ALIGNMENT == std::size_t{ 1 } << (FL_SHIFT - SL_LOG2));
+    static_assert(HEADER_SIZE % ALIGNMENT == 0);
+
+    struct Index
+    {
+        std::uint32_t fl;
+        std::uint32_t sl;
+    };
+
+    static Index Mapping(std::size_t size) noexcept;
+    static std::size_t SizeOf(const Block* block) noexcept;
+    static bool IsFree(const Block* block) noexcept;
+
+    Block* FindFree(std::size_t size) noexcept;
+    void Insert(Block* block) noexcept;
+    void Remove(Block* block) noexcept;
+
+    // Cuts the block to size and returns the remainder to the free lists
+    // when it can hold a block of its own.
+    void Split(Block* block, std::size_t size) noexcept;
+
+    Block* NextPhysical(const Block* block) const noexcept;
+
+    std::uint32_t m_flBitmap;
+    std::array<std::uint32_t, FL_COUNT> m_slBitmaps;
+    std::array<std::array<Block*, SL_COUNT>, FL_COUNT> m_freeBlocks;
+
+    void* m_end; // end of the last block
+};
+}
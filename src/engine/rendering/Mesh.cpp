@@ -6,14 +6,15 @@
 #include <cassert>
 #include <cstdint>
 #include <format>
+#include <memory_resource>
 #include <mutex>
 #include <vector>
 
 namespace Zeus
 {
-Mesh::Mesh(std::string_view name)
-    : m_vertices{},
-      m_indices{},
+Mesh::Mesh(std::string_view name, std::pmr::memory_resource* resource)
+    : m_vertices{ resource },
+      m_indices{ resource },
       m_vertexBuffer{ nullptr },
       m_indexBuffer{ nullptr },
       m_name{ name }
@@ -106,12 +107,12 @@ void Mesh::Clear()
     m_indices.shrink_to_fit();
 }
 
-const std::vector<Vertex>& Mesh::GetVertices() const
+const std::pmr::vector<Vertex>& Mesh::GetVertices() const
 {
     return m_vertices;
 }
 
-const std::vector<std::uint32_t>& Mesh::GetIndices() const
+const std::pmr::vector<std::uint32_t>& Mesh::GetIndices() const
 {
     return m_indices;
 }
@@ -6,6 +6,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <cstdint>
+#include <memory_resource>
 #include <mutex>
 #include <string_view>
 #include <vector>
@@ -15,7 +16,10 @@ namespace Zeus
 class Mesh
 {
 public:
-    Mesh(std::string_view name = "");
+    // Geometry kept on the CPU is allocated from the resource.
+    Mesh(
+        std::string_view name = "",
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     ~Mesh();
 
     void GetGeometry(
@@ -34,8 +38,8 @@ public:
 
     void Clear();
 
-    const std::vector<Vertex>& GetVertices() const;
-    const std::vector<std::uint32_t>& GetIndices() const;
+    const std::pmr::vector<Vertex>& GetVertices() const;
+    const std::pmr::vector<std::uint32_t>& GetIndices() const;
     std::uint32_t GetVertexCount() const;
     std::uint32_t GetIndexCount() const;
 
@@ -48,8 +52,8 @@ public:
     std::string_view GetName() const;
 
 private:
-    std::vector<Vertex> m_vertices;
-    std::vector<std::uint32_t> m_indices;
+    std::pmr::vector<Vertex> m_vertices;
+    std::pmr::vector<std::uint32_t> m_indices;
 
     Buffer* m_vertexBuffer;
     Buffer* m_indexBuffer;
@@ -22,6 +22,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <format>
 #include <memory>
@@ -30,7 +31,13 @@
 
 namespace Zeus
 {
-Renderer::Renderer(const Window& window) : m_window{ window }
+Renderer::Renderer(const Window& window)
+    : m_window{ window },
+      m_frameMemory{ std::make_unique<std::byte[]>(
+          FRAME_ALLOCATOR_SIZE * FRAMES_IN_FLIGHT) },
+      m_frameAllocator{ FRAME_ALLOCATOR_SIZE,
+                        FRAMES_IN_FLIGHT,
+                        m_frameMemory.get() }
 {
     m_lines.reserve(LINES_BUFFER_BASE_SIZE);
 }
@@ -73,9 +80,12 @@ void Renderer::Destroy()
 {
     LOG_DEBUG("Destroying Renderer");
 
-    for (std::uint32_t i{ 0 }; i < m_renderables.size(); ++i)
+    for (RenderSnapshot& snapshot : m_snapshots)
     {
-        m_renderables[i].clear();
+        for (std::vector<RenderProxy>& proxies : snapshot.proxies)
+        {
+            proxies.clear();
+        }
     }
 
     DestroyDefaultResources();
@@ -131,6 +141,9 @@ void Renderer::BeginFrame()
 
     m_swapchain.AcquireNextImage();
 
+    // The fence of the frame signaled, its scratch memory can be reused.
+    m_frameAllocator.BeginFrame(m_swapchain.GetFrameIndex());
+
     // https://gpuopen-librariesandsdks.github.io/VulkanMemoryAllocator/html/staying_within_budget.html
     // Make sure to call vmaSetCurrentFrameIndex() every frame.
     // Budget is queried from Vulkan inside of it to avoid overhead of querying
@@ -287,27 +300,37 @@ const Pipeline& Renderer::GetPipeline(PipelineType type) const
 
 void Renderer::SetEntities(RendererEntity type, ECS::Query<Renderable>& query)
 {
-    // mutex lock
-    GetEntities(type).clear();
+    auto& proxies{
+        m_snapshots[m_extractIndex].proxies[static_cast<std::uint32_t>(type)]
+    };
+    proxies.clear();
 
     for (auto& entity : query)
     {
         if (!entity.isActive)
             continue;
 
-        // isActive
-        GetEntities(type).emplace_back(&entity);
+        proxies.push_back({
+            .transform = entity.localMatrix,
+            .vertexBufferAddress =
+                entity.m_mesh->GetVertexBuffer()->GetDeviceAddress(),
+            .indexBuffer = entity.m_mesh->GetIndexBuffer(),
+            .indexCount = entity.m_mesh->GetIndexCount(),
+        });
     }
 
     if (type == RendererEntity::MESH_TRANSPARENT)
     {
         /*std::sort(*/
-        /*    m_renderables[type].begin(),*/
-        /*    m_renderables[type].end(),*/
+        /*    proxies.begin(),*/
+        /*    proxies.end(),*/
         /*    [&](const auto& a, const auto& b) { return true; });*/
     }
+}
 
-    // mutex lock
+void Renderer::PublishSnapshot()
+{
+    m_extractIndex = (m_extractIndex + 1) % SNAPSHOT_COUNT;
 }
 
 void Renderer::SetCameraProjection(const Math::Matrix4x4f& view_projection)
@@ -615,7 +638,7 @@ void Renderer::UpdateFrameDataBuffer()
 
 void Renderer::DrawEntities(const CommandBuffer& cmd, const Image& renderTarget)
 {
-    const auto meshes{ GetEntities(RendererEntity::MESH_OPAQUE) };
+    const auto& meshes{ GetEntities(RendererEntity::MESH_OPAQUE) };
     if (meshes.empty())
         return;
 
@@ -649,12 +672,11 @@ void Renderer::DrawEntities(const CommandBuffer& cmd, const Image& renderTarget)
         GetPipeline(PipelineType::MESH_OPAQUE),
         1);
 
-    for (const auto entity : meshes)
+    for (const RenderProxy& mesh : meshes)
     {
         PassPushConstants pushConstants{
-            .model = entity->localMatrix,
-            .vertexBufferAddress =
-                entity->m_mesh->GetVertexBuffer()->GetDeviceAddress(),
+            .transform = mesh.transform,
+            .vertexBufferAddress = mesh.vertexBufferAddress,
         };
 
         cmd.PushConstants(
@@ -663,8 +685,8 @@ void Renderer::DrawEntities(const CommandBuffer& cmd, const Image& renderTarget)
             0,
             pushConstants);
 
-        cmd.BindIndexBuffer(*entity->m_mesh->GetIndexBuffer());
-        cmd.DrawIndexed(entity->m_mesh->GetIndexCount());
+        cmd.BindIndexBuffer(*mesh.indexBuffer);
+        cmd.DrawIndexed(mesh.indexCount);
     }
 }
 
@@ -720,8 +742,13 @@ void Renderer::LinesPass(const CommandBuffer& cmd, const Image& renderTarget)
     }
 }
 
-std::vector<const Renderable*>& Renderer::GetEntities(RendererEntity entity)
+const std::vector<RenderProxy>& Renderer::GetEntities(
+    RendererEntity entity) const
 {
-    return m_renderables[static_cast<std::uint32_t>(entity)];
+    // The snapshot published last, extraction writes the other one.
+    const std::uint32_t drawIndex{ (m_extractIndex + SNAPSHOT_COUNT - 1) %
+                                   SNAPSHOT_COUNT };
+
+    return m_snapshots[drawIndex].proxies[static_cast<std::uint32_t>(entity)];
 }
 }
@@ -5,6 +5,7 @@
 #include "components/Renderable.hpp"
 #include "ecs/Query.hpp"
 #include "math/definitions.hpp"
+#include "memory/FrameAllocator.hpp"
 #include "rendering/Material.hpp"
 #include "rhi/Buffer.hpp"
 #include "rhi/CommandBuffer.hpp"
@@ -19,6 +20,7 @@
 #include <vulkan/vulkan_core.h>
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
@@ -65,7 +67,12 @@ public:
     const Shader& GetShader(ShaderType type) const;
     const Sampler& GetSampler(SamplerType type) const;
     const Pipeline& GetPipeline(PipelineType type) const;
+    // Copies the draw data of the active entities into the snapshot being
+    // extracted, the registry can change once this returns.
     void SetEntities(RendererEntity type, ECS::Query<Renderable>& query);
+    // Hands the extracted snapshot to drawing, the next extraction writes the
+    // other one. Recording of the previous snapshot has to be done by then.
+    void PublishSnapshot();
     void SetCameraProjection(const Math::Matrix4x4f& viewProjection);
 
     // Bindless
@@ -81,6 +88,12 @@ public:
         return CurrentFrame().graphicsCommandBuffer;
     }
 
+    // Scratch memory released once the current frame retires.
+    FrameAllocator& GetFrameAllocator()
+    {
+        return m_frameAllocator;
+    }
+
 public:
     // Swapchain/Frames
     void ResizeSwapchain();
@@ -106,7 +119,7 @@ public:
     void PbrPass();
     void LinesPass(const CommandBuffer& cmd, const Image& renderTarget);
 
-    std::vector<const Renderable*>& GetEntities(RendererEntity entity);
+    const std::vector<RenderProxy>& GetEntities(RendererEntity entity) const;
 
     struct RendererFrame
     {
@@ -144,6 +157,7 @@ public:
 private:
     static constexpr std::uint32_t FRAMES_IN_FLIGHT{ 3 };
     static constexpr std::uint32_t LINES_BUFFER_BASE_SIZE{ 32768 };
+    static constexpr std::size_t FRAME_ALLOCATOR_SIZE{ 4u << 20 };
 
     static constexpr VkClearValue CLEAR_VALUES{};
 
@@ -151,6 +165,9 @@ private:
     const Window& m_window;
     class Swapchain m_swapchain;
 
+    std::unique_ptr<std::byte[]> m_frameMemory;
+    FrameAllocator m_frameAllocator;
+
 #define array(type, count) std::array<type, static_cast<std::uint32_t>(count)>
 
     array(RendererFrame, FRAMES_IN_FLIGHT) m_frames;
@@ -160,7 +177,17 @@ private:
 
     // turn it into per frame resoruce
     array(Image, RenderTarget::COUNT) m_renderTargets;
-    array(std::vector<const Renderable*>, RendererEntity::COUNT) m_renderables;
+
+    // Simulation extracts into one snapshot while the other is drawn.
+    static constexpr std::uint32_t SNAPSHOT_COUNT{ 2 };
+
+    struct RenderSnapshot
+    {
+        array(std::vector<RenderProxy>, RendererEntity::COUNT) proxies;
+    };
+
+    std::array<RenderSnapshot, SNAPSHOT_COUNT> m_snapshots;
+    std::uint32_t m_extractIndex{ 0 };
 
     // We use uniform buffer here instead of SSBO because this is a small
     // buffer. We arent using it through buffer device adress because we have a
@@ -3,6 +3,7 @@
 #include "Material.hpp"
 #include "math/definitions.hpp"
 #include "math/transformations.hpp"
+#include "rhi/Buffer.hpp"
 
 #include <vulkan/vulkan_core.h>
 
@@ -90,4 +91,14 @@ static_assert(offsetof(PassPushConstants, transform) == 0);
 static_assert(offsetof(PassPushConstants, vertexBufferAddress) == 64);
 static_assert(offsetof(PassPushConstants, materialIndex) == 72);
 static_assert(sizeof(PassPushConstants) <= 128, "Push constants size limit.");
+
+// Draw data extracted from a Renderable. The renderer records from proxies
+// and never reads components the simulation may be writing.
+struct RenderProxy
+{
+    Math::Matrix4x4f transform;
+    VkDeviceAddress vertexBufferAddress;
+    const Buffer* indexBuffer;
+    std::uint32_t indexCount;
+};
 }
@@ -0,0 +1,122 @@
+#include <core/JobSystem.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void ThreadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const std::uint32_t hardwareThreads{ std::max(
+        std::thread::hardware_concurrency(),
+        1u) };
+
+    for (std::uint32_t threads{ 1 }; threads < hardwareThreads; threads *= 2)
+    {
+        benchmark->Arg(threads);
+    }
+
+    benchmark->Arg(hardwareThreads);
+}
+
+// The benchmark argument counts the calling thread as well.
+void InitializeJobSystem(const benchmark::State& state)
+{
+    Zeus::JobSystem::Initialize(static_cast<std::uint32_t>(state.range(0) - 1));
+}
+}
+
+// Cost of scheduling, running and waiting on an empty job.
+static void BM_JobSystem_ExecuteOverhead(benchmark::State& state)
+{
+    constexpr std::uint32_t JOB_COUNT{ 4096 };
+
+    InitializeJobSystem(state);
+
+    auto job = [](std::uint32_t, std::uint32_t) {};
+
+    for (auto _ : state)
+    {
+        Zeus::JobCounter counter;
+        for (std::uint32_t i{ 0 }; i < JOB_COUNT; ++i)
+        {
+            Zeus::JobSystem::Execute(
+                Zeus::JobSystem::MakeJob(job, i, i + 1, &counter));
+        }
+
+        Zeus::JobSystem::Wait(counter);
+    }
+
+    Zeus::JobSystem::Shutdown();
+
+    state.SetItemsProcessed(state.iterations() * JOB_COUNT);
+}
+BENCHMARK(BM_JobSystem_ExecuteOverhead)->Apply(ThreadCounts)->UseRealTime();
+
+// Same as above with every job deferred behind a dependency.
+static void BM_JobSystem_DependencyOverhead(benchmark::State& state)
+{
+    constexpr std::uint32_t JOB_COUNT{ 4096 };
+
+    InitializeJobSystem(state);
+
+    auto job = [](std::uint32_t, std::uint32_t) {};
+
+    for (auto _ : state)
+    {
+        Zeus::JobCounter dependency;
+        Zeus::JobCounter counter;
+
+        Zeus::JobSystem::Execute(
+            Zeus::JobSystem::MakeJob(job, 0, 1, &dependency));
+
+        for (std::uint32_t i{ 0 }; i < JOB_COUNT; ++i)
+        {
+            Zeus::JobSystem::Execute(
+                Zeus::JobSystem::MakeJob(job, i, i + 1, &counter),
+                &dependency);
+        }
+
+        Zeus::JobSystem::Wait(counter);
+        Zeus::JobSystem::Wait(dependency);
+    }
+
+    Zeus::JobSystem::Shutdown();
+
+    state.SetItemsProcessed(state.iterations() * JOB_COUNT);
+}
+BENCHMARK(BM_JobSystem_DependencyOverhead)->Apply(ThreadCounts)->UseRealTime();
+
+// Scaling of a compute bound loop from one thread to every hardware thread.
+static void BM_JobSystem_ParallelForScaling(benchmark::State& state)
+{
+    constexpr std::uint32_t COUNT{ 1 << 20 };
+
+    InitializeJobSystem(state);
+
+    std::vector<float> values(COUNT, 1.0f);
+
+    for (auto _ : state)
+    {
+        Zeus::JobSystem::ParallelFor(
+            COUNT,
+            Zeus::JobSystem::DEFAULT_BATCH_SIZE,
+            [&](std::uint32_t begin, std::uint32_t end) {
+                for (std::uint32_t i{ begin }; i < end; ++i)
+                    values[i] = std::sqrt(values[i] * 1.0001f + 0.5f);
+            });
+
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+
+    Zeus::JobSystem::Shutdown();
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_JobSystem_ParallelForScaling)->Apply(ThreadCounts)->UseRealTime();
@@ -0,0 +1,88 @@
+#include <ecs/Entity.hpp>
+#include <ecs/Hierarchy.hpp>
+#include <math/definitions.hpp>
+#include <math/transformations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace Zeus;
+
+namespace
+{
+constexpr ECS::Entity ROOT_COUNT{ 1000 };
+constexpr ECS::Entity NODES_PER_ROOT{ 100 };
+
+// Every root carries a chain of ten nodes with nine leaves each.
+void BuildScene(ECS::Hierarchy& hierarchy)
+{
+    const Math::Matrix4x4f local{ Math::uniformScale<float>(1.0f) };
+
+    for (ECS::Entity root{ 0 }; root < ROOT_COUNT * NODES_PER_ROOT;
+         root += NODES_PER_ROOT)
+    {
+        hierarchy.Insert(root, ECS::Hierarchy::NO_PARENT, local);
+
+        ECS::Entity parent{ root };
+        for (ECS::Entity node{ root + 1 }; node < root + NODES_PER_ROOT; ++node)
+        {
+            hierarchy.Insert(node, parent, local);
+
+            if (node % 10 == 0)
+                parent = node;
+        }
+    }
+
+    hierarchy.Propagate();
+}
+}
+
+static void BM_Hierarchy_Propagate_AllDirty(benchmark::State& state)
+{
+    ECS::Hierarchy hierarchy;
+    BuildScene(hierarchy);
+
+    const Math::Matrix4x4f local{ Math::uniformScale<float>(1.0f) };
+
+    for (auto _ : state)
+    {
+        for (ECS::Entity root{ 0 }; root < ROOT_COUNT * NODES_PER_ROOT;
+             root += NODES_PER_ROOT)
+        {
+            hierarchy.SetLocal(root, local);
+        }
+
+        hierarchy.Propagate();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * ROOT_COUNT * NODES_PER_ROOT);
+}
+BENCHMARK(BM_Hierarchy_Propagate_AllDirty);
+
+// Most of the scene is static, one leaf in a hundred roots moves.
+static void BM_Hierarchy_Propagate_FewDirty(benchmark::State& state)
+{
+    ECS::Hierarchy hierarchy;
+    BuildScene(hierarchy);
+
+    const Math::Matrix4x4f local{ Math::uniformScale<float>(1.0f) };
+
+    for (auto _ : state)
+    {
+        for (ECS::Entity root{ 0 }; root < ROOT_COUNT * NODES_PER_ROOT;
+             root += NODES_PER_ROOT * 100)
+        {
+            hierarchy.SetLocal(root + NODES_PER_ROOT - 1, local);
+        }
+
+        hierarchy.Propagate();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * ROOT_COUNT * NODES_PER_ROOT);
+}
+BENCHMARK(BM_Hierarchy_Propagate_FewDirty);
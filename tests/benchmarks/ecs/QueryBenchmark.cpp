@@ -0,0 +1,164 @@
+#include <ecs/Entity.hpp>
+#include <ecs/Registry.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+template <int Id>
+struct QueryComponent
+{
+    float x;
+    float y;
+    float z;
+};
+
+using Position = QueryComponent<0>;
+using Velocity = QueryComponent<1>;
+using Acceleration = QueryComponent<2>;
+using Mass = QueryComponent<3>;
+
+// Every entity holds the four components, pools are in creation order.
+void Populate(ECS::Registry& registry, std::size_t count)
+{
+    std::vector<ECS::Entity> entities(count);
+    registry.CreateMany(count, entities.begin());
+
+    registry.EmplaceMany<Position>(entities.begin(), entities.end());
+    registry.EmplaceMany<Velocity>(
+        entities.begin(),
+        entities.end(),
+        Velocity{ 1.0f, 1.0f, 1.0f });
+    registry.EmplaceMany<Acceleration>(
+        entities.begin(),
+        entities.end(),
+        Acceleration{ 0.1f, 0.1f, 0.1f });
+    registry.EmplaceMany<Mass>(
+        entities.begin(),
+        entities.end(),
+        Mass{ 1.0f, 1.0f, 1.0f });
+}
+
+std::size_t EntityCount(const benchmark::State& state)
+{
+    return static_cast<std::size_t>(state.range(0));
+}
+
+void EntityCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->RangeMultiplier(10)->Range(10000, 1000000);
+}
+}
+
+static void BM_Query_1Component(benchmark::State& state)
+{
+    ECS::Registry registry;
+    Populate(registry, EntityCount(state));
+
+    auto query{ registry.QueryAll<Position>() };
+
+    for (auto _ : state)
+    {
+        query.Each([](Position& position) { position.x += 1.0f; });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(EntityCount(state)));
+}
+BENCHMARK(BM_Query_1Component)->Apply(EntityCounts);
+
+static void BM_Query_2Components(benchmark::State& state)
+{
+    ECS::Registry registry;
+    Populate(registry, EntityCount(state));
+
+    auto query{ registry.QueryAll<Position, Velocity>() };
+
+    for (auto _ : state)
+    {
+        query.Each([](Position& position, const Velocity& velocity) {
+            position.x += velocity.x;
+            position.y += velocity.y;
+            position.z += velocity.z;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(EntityCount(state)));
+}
+BENCHMARK(BM_Query_2Components)->Apply(EntityCounts);
+
+static void BM_Query_4Components(benchmark::State& state)
+{
+    ECS::Registry registry;
+    Populate(registry, EntityCount(state));
+
+    auto query{ registry.QueryAll<Position, Velocity, Acceleration, Mass>() };
+
+    for (auto _ : state)
+    {
+        query.Each([](Position& position,
+                      Velocity& velocity,
+                      const Acceleration& acceleration,
+                      const Mass& mass) {
+            velocity.x += acceleration.x / mass.x;
+            velocity.y += acceleration.y / mass.y;
+            velocity.z += acceleration.z / mass.z;
+            position.x += velocity.x;
+            position.y += velocity.y;
+            position.z += velocity.z;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(EntityCount(state)));
+}
+BENCHMARK(BM_Query_4Components)->Apply(EntityCounts);
+
+// Half of the entities move, in an order unrelated to the position pool.
+// The query is driven by the smaller pool and the other lookups are random.
+static void BM_Query_Fragmented(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(EntityCount(state));
+    registry.CreateMany(entities.size(), entities.begin());
+    registry.EmplaceMany<Position>(entities.begin(), entities.end());
+
+    std::mt19937 random{ 42 };
+    std::shuffle(entities.begin(), entities.end(), random);
+    entities.resize(entities.size() / 2);
+
+    registry.EmplaceMany<Velocity>(
+        entities.begin(),
+        entities.end(),
+        Velocity{ 1.0f, 1.0f, 1.0f });
+
+    auto query{ registry.QueryAll<Position, Velocity>() };
+
+    for (auto _ : state)
+    {
+        query.Each([](Position& position, const Velocity& velocity) {
+            position.x += velocity.x;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(entities.size()));
+}
+BENCHMARK(BM_Query_Fragmented)->Apply(EntityCounts);
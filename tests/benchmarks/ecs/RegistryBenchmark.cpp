@@ -0,0 +1,548 @@
+#include <ecs/ComponentSparseSet.hpp>
+#include <ecs/Entity.hpp>
+#include <ecs/FamilyId.hpp>
+#include <ecs/Registry.hpp>
+#include <ecs/SparseSet.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+struct BenchmarkPosition
+{
+    float x;
+    float y;
+    float z;
+};
+
+struct BenchmarkVelocity
+{
+    float x;
+    float y;
+    float z;
+};
+
+// The pool lookup Registry used before the dense family table.
+class HashedPools
+{
+public:
+    template <typename Component>
+    ECS::ComponentSparseSet<Component>* GetPool()
+    {
+        Family family{ FamilyId::Type<Component>() };
+
+        if (!m_pools.contains(family))
+        {
+            m_pools[family] =
+                std::make_unique<ECS::ComponentSparseSet<Component>>();
+        }
+
+        return static_cast<ECS::ComponentSparseSet<Component>*>(
+            m_pools[family].get());
+    }
+
+private:
+    std::unordered_map<std::uint32_t, std::unique_ptr<ECS::SparseSet>> m_pools;
+};
+
+constexpr ECS::Entity ENTITY_COUNT{ 10000 };
+}
+
+static void BM_Registry_Get(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities{};
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+        registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+        entities.push_back(entity);
+    }
+
+    for (auto _ : state)
+    {
+        for (const ECS::Entity entity : entities)
+        {
+            auto& position{ registry.Get<BenchmarkPosition>(entity) };
+            const auto& velocity{ registry.Get<BenchmarkVelocity>(entity) };
+            position.x += velocity.x;
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT * 2);
+}
+BENCHMARK(BM_Registry_Get);
+
+static void BM_Registry_Get_HashedPools(benchmark::State& state)
+{
+    HashedPools pools;
+    std::vector<ECS::Entity> entities{};
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        pools.GetPool<BenchmarkPosition>()->Emplace(i, 1.0f, 2.0f, 3.0f);
+        pools.GetPool<BenchmarkVelocity>()->Emplace(i, 1.0f, 1.0f, 1.0f);
+        entities.push_back(i);
+    }
+
+    for (auto _ : state)
+    {
+        for (const ECS::Entity entity : entities)
+        {
+            auto& position{ pools.GetPool<BenchmarkPosition>()->Get(entity) };
+            const auto& velocity{
+                pools.GetPool<BenchmarkVelocity>()->Get(entity)
+            };
+            position.x += velocity.x;
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT * 2);
+}
+BENCHMARK(BM_Registry_Get_HashedPools);
+
+static void BM_Registry_AllOf(benchmark::State& state)
+{
+    ECS::Registry registry;
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+
+        if (i % 2 == 0)
+            registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    for (auto _ : state)
+    {
+        std::uint32_t matches{ 0 };
+        for (ECS::Entity entity{ 0 }; entity < ENTITY_COUNT; ++entity)
+        {
+            matches += registry.AllOf<BenchmarkPosition, BenchmarkVelocity>(
+                           entity)
+                           ? 1u
+                           : 0u;
+        }
+
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Registry_AllOf);
+
+static void BM_Query_Each(benchmark::State& state)
+{
+    ECS::Registry registry;
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+        registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    auto query{ registry.QueryAll<BenchmarkPosition, BenchmarkVelocity>() };
+
+    for (auto _ : state)
+    {
+        query.Each([](BenchmarkPosition& position,
+                      const BenchmarkVelocity& velocity) {
+            position.x += velocity.x;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Query_Each);
+
+static void BM_Group_Each(benchmark::State& state)
+{
+    ECS::Registry registry;
+    auto group{ registry.Group<BenchmarkPosition, BenchmarkVelocity>() };
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+        registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    for (auto _ : state)
+    {
+        group.Each([](BenchmarkPosition& position,
+                      const BenchmarkVelocity& velocity) {
+            position.x += velocity.x;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Group_Each);
+
+// Excluding with a per entity AllOf, how Without used to be emulated.
+static void BM_Query_Each_AllOfExclusion(benchmark::State& state)
+{
+    ECS::Registry registry;
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+
+        if (i % 2 == 0)
+            registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    auto query{ registry.QueryAll<BenchmarkPosition>() };
+
+    for (auto _ : state)
+    {
+        ECS::Entity entity{ 0 };
+        query.Each([&](BenchmarkPosition& position) {
+            if (!registry.AllOf<BenchmarkVelocity>(entity++))
+                position.x += 1.0f;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Query_Each_AllOfExclusion);
+
+static void BM_Query_Each_Without(benchmark::State& state)
+{
+    ECS::Registry registry;
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<BenchmarkPosition>(entity, 1.0f, 2.0f, 3.0f);
+
+        if (i % 2 == 0)
+            registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    auto query{
+        registry.QueryAll<BenchmarkPosition, ECS::Without<BenchmarkVelocity>>()
+    };
+
+    for (auto _ : state)
+    {
+        query.Each([](BenchmarkPosition& position) { position.x += 1.0f; });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Query_Each_Without);
+
+// Spawns and despawns a burst of entities with per entity calls.
+static void BM_Registry_Burst_Loop(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(ENTITY_COUNT);
+
+    for (auto _ : state)
+    {
+        for (ECS::Entity& entity : entities)
+        {
+            entity = registry.Create();
+            registry.Emplace<BenchmarkPosition>(entity, 0.0f, 0.0f, 0.0f);
+            registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+        }
+
+        for (const ECS::Entity entity : entities)
+            registry.Destroy(entity);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Registry_Burst_Loop);
+
+static void BM_Registry_Burst_Many(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(ENTITY_COUNT);
+
+    for (auto _ : state)
+    {
+        registry.CreateMany(entities.size(), entities.begin());
+        registry.EmplaceMany<BenchmarkPosition>(
+            entities.begin(),
+            entities.end(),
+            BenchmarkPosition{ 0.0f, 0.0f, 0.0f });
+        registry.EmplaceMany<BenchmarkVelocity>(
+            entities.begin(),
+            entities.end(),
+            BenchmarkVelocity{ 1.0f, 1.0f, 1.0f });
+
+        registry.DestroyMany(entities.begin(), entities.end());
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Registry_Burst_Many);
+
+namespace
+{
+struct BenchmarkMesh
+{
+    std::uint32_t mesh;
+    std::uint32_t material;
+};
+
+constexpr std::size_t INSTANCE_COUNT{ 100000 };
+}
+
+// Spawns copies of a prefab with one Emplace per component.
+static void BM_Registry_Instantiate_Emplace(benchmark::State& state)
+{
+    ECS::Registry registry;
+    const ECS::Entity prefab{ registry.Create() };
+    registry.Emplace<BenchmarkPosition>(prefab, 1.0f, 2.0f, 3.0f);
+    registry.Emplace<BenchmarkVelocity>(prefab, 1.0f, 1.0f, 1.0f);
+    registry.Emplace<BenchmarkMesh>(prefab, 4u, 2u);
+
+    std::vector<ECS::Entity> instances(INSTANCE_COUNT);
+
+    for (auto _ : state)
+    {
+        for (ECS::Entity& instance : instances)
+        {
+            instance = registry.Create();
+            registry.Emplace<BenchmarkPosition>(
+                instance,
+                registry.Get<BenchmarkPosition>(prefab));
+            registry.Emplace<BenchmarkVelocity>(
+                instance,
+                registry.Get<BenchmarkVelocity>(prefab));
+            registry.Emplace<BenchmarkMesh>(
+                instance,
+                registry.Get<BenchmarkMesh>(prefab));
+        }
+
+        state.PauseTiming();
+        registry.DestroyMany(instances.begin(), instances.end());
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(INSTANCE_COUNT));
+}
+BENCHMARK(BM_Registry_Instantiate_Emplace)->Unit(benchmark::kMillisecond);
+
+static void BM_Registry_Instantiate(benchmark::State& state)
+{
+    ECS::Registry registry;
+    const ECS::Entity prefab{ registry.Create() };
+    registry.Emplace<BenchmarkPosition>(prefab, 1.0f, 2.0f, 3.0f);
+    registry.Emplace<BenchmarkVelocity>(prefab, 1.0f, 1.0f, 1.0f);
+    registry.Emplace<BenchmarkMesh>(prefab, 4u, 2u);
+
+    std::vector<ECS::Entity> instances(INSTANCE_COUNT);
+
+    for (auto _ : state)
+    {
+        registry.Instantiate(prefab, instances.size(), instances.begin());
+
+        state.PauseTiming();
+        registry.DestroyMany(instances.begin(), instances.end());
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(INSTANCE_COUNT));
+}
+BENCHMARK(BM_Registry_Instantiate)->Unit(benchmark::kMillisecond);
+
+namespace
+{
+// Depth ordering changes a little between frames, one item in 64 moves past
+// its neighbour.
+void DisturbDepth(ECS::Registry& registry, std::uint32_t& seed)
+{
+    registry.QueryAll<BenchmarkPosition>().Each(
+        [&seed](BenchmarkPosition& position) {
+            seed = seed * 1664525u + 1013904223u;
+            if (seed % 64 == 0)
+                position.z += 1.5f;
+        });
+}
+
+bool FrontToBack(const BenchmarkPosition& lhs, const BenchmarkPosition& rhs)
+{
+    return lhs.z < rhs.z;
+}
+
+template <ECS::SortMode Mode>
+void SortNearlySorted(benchmark::State& state)
+{
+    ECS::Registry registry;
+
+    for (ECS::Entity i{ 0 }; i < ENTITY_COUNT; ++i)
+    {
+        registry.Create<BenchmarkPosition>(0.0f, 0.0f, static_cast<float>(i));
+    }
+
+    std::uint32_t seed{ 1 };
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        DisturbDepth(registry, seed);
+        state.ResumeTiming();
+
+        registry.Sort<BenchmarkPosition>(FrontToBack, Mode);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+}
+
+static void BM_Registry_Sort_Full(benchmark::State& state)
+{
+    SortNearlySorted<ECS::SortMode::Full>(state);
+}
+BENCHMARK(BM_Registry_Sort_Full);
+
+static void BM_Registry_Sort_Insertion(benchmark::State& state)
+{
+    SortNearlySorted<ECS::SortMode::Insertion>(state);
+}
+BENCHMARK(BM_Registry_Sort_Insertion);
+
+namespace
+{
+template <int Id>
+struct PoolComponent
+{
+    std::uint32_t value;
+};
+
+constexpr std::size_t CHURN_POPULATION{ 100000 };
+constexpr std::size_t POOL_COUNT{ 16 };
+
+template <std::size_t... Ids>
+void EmplaceEvery(
+    ECS::Registry& registry,
+    std::vector<ECS::Entity>& entities,
+    std::index_sequence<Ids...>)
+{
+    (registry.EmplaceMany<PoolComponent<static_cast<int>(Ids)>>(
+         entities.begin(),
+         entities.end()),
+     ...);
+}
+}
+
+// A steady population where a tenth of the entities is replaced every
+// iteration, in random order.
+static void BM_Registry_Churn(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(CHURN_POPULATION);
+
+    for (ECS::Entity& entity : entities)
+    {
+        entity = registry.Create();
+        registry.Emplace<BenchmarkPosition>(entity, 0.0f, 0.0f, 0.0f);
+        registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+
+    std::mt19937 random{ 42 };
+    for (auto _ : state)
+    {
+        for (std::size_t i{ 0 }; i < CHURN_POPULATION / 10; ++i)
+        {
+            ECS::Entity& entity{ entities[random() % CHURN_POPULATION] };
+            registry.Destroy(entity);
+
+            entity = registry.Create();
+            registry.Emplace<BenchmarkPosition>(entity, 0.0f, 0.0f, 0.0f);
+            registry.Emplace<BenchmarkVelocity>(entity, 1.0f, 1.0f, 1.0f);
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(CHURN_POPULATION / 10));
+}
+BENCHMARK(BM_Registry_Churn);
+
+// Get in an order unrelated to the pool, as done when following references
+// between entities.
+static void BM_Registry_Get_Random(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(static_cast<std::size_t>(state.range(0)));
+    registry.CreateMany(entities.size(), entities.begin());
+    registry.EmplaceMany<BenchmarkPosition>(entities.begin(), entities.end());
+
+    std::mt19937 random{ 42 };
+    std::shuffle(entities.begin(), entities.end(), random);
+
+    for (auto _ : state)
+    {
+        float sum{ 0.0f };
+        for (const ECS::Entity entity : entities)
+            sum += registry.Get<BenchmarkPosition>(entity).x;
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(entities.size()));
+}
+BENCHMARK(BM_Registry_Get_Random)->RangeMultiplier(10)->Range(10000, 1000000);
+
+// Destroy visits every pool, most of which do not hold the entity.
+static void BM_Registry_Destroy_ManyPools(benchmark::State& state)
+{
+    ECS::Registry registry;
+    std::vector<ECS::Entity> entities(ENTITY_COUNT);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        registry.CreateMany(entities.size(), entities.begin());
+        EmplaceEvery(
+            registry,
+            entities,
+            std::make_index_sequence<POOL_COUNT>{});
+        state.ResumeTiming();
+
+        for (const ECS::Entity entity : entities)
+            registry.Destroy(entity);
+
+        state.PauseTiming();
+        registry.Clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * ENTITY_COUNT);
+}
+BENCHMARK(BM_Registry_Destroy_ManyPools);
@@ -0,0 +1,102 @@
+#include <ecs/Entity.hpp>
+#include <ecs/Registry.hpp>
+#include <ecs/Snapshot.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+using namespace Zeus;
+
+namespace
+{
+struct SnapshotPosition
+{
+    float x;
+    float y;
+    float z;
+};
+
+struct SnapshotVelocity
+{
+    float x;
+    float y;
+    float z;
+};
+
+constexpr ECS::Entity WORLD_SIZE{ 1000000 };
+
+// Reads a snapshot kept in memory without copying it into a stringstream.
+class MemoryBuffer : public std::streambuf
+{
+public:
+    MemoryBuffer(std::string& bytes)
+    {
+        setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+    }
+};
+
+void PopulateWorld(ECS::Registry& registry)
+{
+    for (ECS::Entity i{ 0 }; i < WORLD_SIZE; ++i)
+    {
+        const ECS::Entity entity{ registry.Create() };
+        const auto value{ static_cast<float>(i) };
+        registry.Emplace<SnapshotPosition>(entity, value, value, value);
+        registry.Emplace<SnapshotVelocity>(entity, 1.0f, 1.0f, 1.0f);
+    }
+}
+}
+
+// Level loading by replaying the construction of every entity.
+static void BM_Snapshot_PerEntityConstruction(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        ECS::Registry registry;
+        PopulateWorld(registry);
+        benchmark::DoNotOptimize(registry);
+    }
+
+    state.SetItemsProcessed(state.iterations() * WORLD_SIZE);
+}
+BENCHMARK(BM_Snapshot_PerEntityConstruction)->Unit(benchmark::kMillisecond);
+
+static void BM_Snapshot_Load(benchmark::State& state)
+{
+    ECS::Snapshot snapshot;
+    snapshot.Register<SnapshotPosition>("Position");
+    snapshot.Register<SnapshotVelocity>("Velocity");
+
+    std::string bytes{};
+    {
+        ECS::Registry registry;
+        PopulateWorld(registry);
+
+        std::ostringstream stream;
+        snapshot.Save(registry, stream);
+        bytes = stream.str();
+    }
+
+    for (auto _ : state)
+    {
+        MemoryBuffer buffer{ bytes };
+        std::istream stream{ &buffer };
+
+        ECS::Registry registry;
+        if (!snapshot.Load(registry, stream))
+            state.SkipWithError("Failed to load snapshot");
+
+        benchmark::DoNotOptimize(registry);
+    }
+
+    state.SetItemsProcessed(state.iterations() * WORLD_SIZE);
+    state.SetBytesProcessed(
+        state.iterations() * static_cast<std::int64_t>(bytes.size()));
+}
+BENCHMARK(BM_Snapshot_Load)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,65 @@
+#include <memory/FreeListAllocator.hpp>
+#include <memory/TlsfAllocator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+constexpr std::size_t HEAP_SIZE{ 64u << 20 };
+constexpr std::size_t MAX_ALLOCATION_SIZE{ 4096 };
+
+// Fills the heap with live allocations of random sizes, then frees a random
+// one and allocates a new one per step. The free list fragments as the
+// benchmark runs, the argument is the number of live allocations.
+template <typename Allocator>
+void RandomChurn(benchmark::State& state)
+{
+    void* memory{ std::malloc(HEAP_SIZE) };
+
+    {
+        Allocator allocator{ HEAP_SIZE, memory };
+
+        std::vector<void*> allocations(
+            static_cast<std::size_t>(state.range(0)));
+        std::mt19937 random{ 42 };
+
+        for (void*& allocation : allocations)
+            allocation = allocator.Allocate(1 + random() % MAX_ALLOCATION_SIZE);
+
+        for (auto _ : state)
+        {
+            void*& allocation{ allocations[random() % allocations.size()] };
+
+            allocator.Free(allocation);
+            allocation = allocator.Allocate(1 + random() % MAX_ALLOCATION_SIZE);
+
+            benchmark::DoNotOptimize(allocation);
+        }
+
+        for (void* allocation : allocations)
+            allocator.Free(allocation);
+    }
+
+    std::free(memory);
+
+    state.SetItemsProcessed(state.iterations());
+}
+}
+
+static void BM_FreeListAllocator_RandomChurn(benchmark::State& state)
+{
+    RandomChurn<Zeus::FreeListAllocator>(state);
+}
+BENCHMARK(BM_FreeListAllocator_RandomChurn)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_TlsfAllocator_RandomChurn(benchmark::State& state)
+{
+    RandomChurn<Zeus::TlsfAllocator>(state);
+}
+BENCHMARK(BM_TlsfAllocator_RandomChurn)->Arg(100)->Arg(1000)->Arg(10000);
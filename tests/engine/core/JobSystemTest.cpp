@@ -0,0 +1,172 @@
+#include <core/JobSystem.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST(JobSystemTest, ParallelFor_NotInitialized_RunsInline)
+{
+    std::vector<int> values(100, 0);
+    std::thread::id caller{ std::this_thread::get_id() };
+    bool sameThread{ true };
+
+    Zeus::JobSystem::ParallelFor(
+        100,
+        10,
+        [&](std::uint32_t begin, std::uint32_t end) {
+            sameThread &= std::this_thread::get_id() == caller;
+
+            for (std::uint32_t i{ begin }; i < end; ++i)
+                values[i] = 1;
+        });
+
+    EXPECT_FALSE(Zeus::JobSystem::IsInitialized());
+    EXPECT_TRUE(sameThread);
+    EXPECT_EQ(std::count(values.begin(), values.end(), 1), 100);
+}
+
+TEST(JobSystemTest, ParallelFor_VisitsEveryIndexOnce)
+{
+    Zeus::JobSystem::Initialize(3);
+
+    std::vector<std::atomic<int>> values(10000);
+    std::atomic<std::uint32_t> batches{ 0 };
+
+    Zeus::JobSystem::ParallelFor(
+        10000,
+        64,
+        [&](std::uint32_t begin, std::uint32_t end) {
+            ++batches;
+
+            for (std::uint32_t i{ begin }; i < end; ++i)
+                ++values[i];
+        });
+
+    Zeus::JobSystem::Shutdown();
+
+    EXPECT_EQ(batches, (10000 + 63) / 64);
+    for (const auto& value : values)
+    {
+        EXPECT_EQ(value, 1);
+    }
+}
+
+TEST(JobSystemTest, ThreadCount_WorkersAndCaller)
+{
+    Zeus::JobSystem::Initialize(2);
+
+    auto threadCount = Zeus::JobSystem::ThreadCount();
+    auto threadIndex = Zeus::JobSystem::ThreadIndex();
+
+    Zeus::JobSystem::Shutdown();
+
+    EXPECT_EQ(threadCount, 3);
+    EXPECT_EQ(threadIndex, 0);
+    EXPECT_EQ(Zeus::JobSystem::ThreadCount(), 1);
+}
+
+TEST(JobSystemTest, Execute_Dependency_RunsAfterDependency)
+{
+    Zeus::JobSystem::Initialize(3);
+
+    std::atomic<std::uint32_t> finished{ 0 };
+    std::atomic<bool> ordered{ true };
+
+    auto first = [&](std::uint32_t, std::uint32_t) {
+        std::this_thread::yield();
+        ++finished;
+    };
+    auto second = [&](std::uint32_t, std::uint32_t) {
+        ordered = ordered && finished == 16;
+    };
+
+    Zeus::JobCounter firstCounter;
+    Zeus::JobCounter secondCounter;
+
+    Zeus::JobSystem::Dispatch(16, 1, first, firstCounter);
+    Zeus::JobSystem::Dispatch(8, 1, second, secondCounter, &firstCounter);
+
+    // Deferred jobs are already tracked by their counter.
+    Zeus::JobSystem::Wait(secondCounter);
+    Zeus::JobSystem::Wait(firstCounter);
+
+    Zeus::JobSystem::Shutdown();
+
+    EXPECT_EQ(finished, 16);
+    EXPECT_TRUE(ordered);
+}
+
+TEST(JobSystemTest, Execute_DoneDependency_RunsImmediately)
+{
+    Zeus::JobSystem::Initialize(1);
+
+    std::atomic<int> value{ 0 };
+    auto job = [&](std::uint32_t begin, std::uint32_t) {
+        value += static_cast<int>(begin);
+    };
+
+    Zeus::JobCounter dependency;
+    Zeus::JobCounter counter;
+    Zeus::JobSystem::Execute(
+        Zeus::JobSystem::MakeJob(job, 5, 6, &counter),
+        &dependency);
+    Zeus::JobSystem::Wait(counter);
+
+    Zeus::JobSystem::Shutdown();
+
+    EXPECT_EQ(value, 5);
+}
+
+TEST(JobSystemTest, Execute_Chain_RunsInOrder)
+{
+    Zeus::JobSystem::Initialize(3);
+
+    std::vector<std::uint32_t> order{};
+    std::mutex mutex;
+
+    auto job = [&](std::uint32_t begin, std::uint32_t) {
+        std::lock_guard lock{ mutex };
+        order.push_back(begin);
+    };
+
+    std::vector<Zeus::JobCounter> counters(8);
+    for (std::uint32_t i{ 0 }; i < counters.size(); ++i)
+    {
+        Zeus::JobSystem::Execute(
+            Zeus::JobSystem::MakeJob(job, i, i + 1, &counters[i]),
+            i > 0 ? &counters[i - 1] : nullptr);
+    }
+
+    Zeus::JobSystem::Wait(counters.back());
+    Zeus::JobSystem::Shutdown();
+
+    ASSERT_EQ(order.size(), 8);
+    for (std::uint32_t i{ 0 }; i < order.size(); ++i)
+    {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(JobSystemTest, Execute_NotInitialized_RunsDeferredInline)
+{
+    std::vector<std::uint32_t> order{};
+    auto job = [&](std::uint32_t begin, std::uint32_t) {
+        order.push_back(begin);
+    };
+
+    Zeus::JobCounter first;
+    Zeus::JobCounter second;
+    Zeus::JobSystem::Execute(Zeus::JobSystem::MakeJob(job, 0, 1, &first));
+    Zeus::JobSystem::Execute(
+        Zeus::JobSystem::MakeJob(job, 1, 2, &second),
+        &first);
+
+    EXPECT_TRUE(first.IsDone());
+    EXPECT_TRUE(second.IsDone());
+    EXPECT_EQ(order, (std::vector<std::uint32_t>{ 0, 1 }));
+}
@@ -0,0 +1,274 @@
+#include <ecs/ArchetypeRegistry.hpp>
+#include <ecs/Entity.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace Zeus;
+
+struct ArchetypeAComponent
+{
+    int number;
+};
+
+struct ArchetypeBComponent
+{
+    int number;
+    const char* string;
+};
+
+struct ArchetypeCComponent
+{
+    std::unique_ptr<std::string> text;
+};
+
+struct ArchetypeDComponent
+{
+    std::string text;
+};
+
+struct ArchetypeEComponent
+{
+    std::string copy;
+};
+
+TEST(ArchetypeRegistryTest, Create_EmptyEntity_IsValid)
+{
+    ECS::ArchetypeRegistry sut;
+
+    ECS::Entity entity0 = sut.Create();
+    ECS::Entity entity1 = sut.Create();
+
+    EXPECT_TRUE(sut.IsValid(entity0));
+    EXPECT_TRUE(sut.IsValid(entity1));
+    EXPECT_FALSE(sut.IsValid(2));
+    EXPECT_EQ(sut.ArchetypeCount(), 1);
+}
+
+TEST(ArchetypeRegistryTest, Create_NewEntity_WithComponent)
+{
+    ECS::ArchetypeRegistry sut;
+
+    ECS::Entity actual = sut.Create<ArchetypeAComponent>(42);
+
+    EXPECT_TRUE(sut.IsValid(actual));
+    EXPECT_EQ(sut.Get<ArchetypeAComponent>(actual).number, 42);
+    EXPECT_EQ(sut.ArchetypeCount(), 2);
+}
+
+TEST(ArchetypeRegistryTest, Destroy_EntityWithComponents_MovesLastEntity)
+{
+    ECS::ArchetypeRegistry sut;
+
+    ECS::Entity entity0 = sut.Create<ArchetypeAComponent>(1);
+    ECS::Entity entity1 = sut.Create<ArchetypeAComponent>(2);
+    ECS::Entity entity2 = sut.Create<ArchetypeAComponent>(3);
+
+    sut.Destroy(entity0);
+
+    EXPECT_FALSE(sut.IsValid(entity0));
+    EXPECT_EQ(sut.Get<ArchetypeAComponent>(entity1).number, 2);
+    EXPECT_EQ(sut.Get<ArchetypeAComponent>(entity2).number, 3);
+}
+
+TEST(ArchetypeRegistryTest, Clear_Entities_Empty)
+{
+    ECS::ArchetypeRegistry sut;
+
+    ECS::Entity entity0 = sut.Create();
+    ECS::Entity entity1 = sut.Create<ArchetypeAComponent>(1);
+
+    sut.Clear();
+
+    EXPECT_FALSE(sut.IsValid(entity0));
+    EXPECT_FALSE(sut.IsValid(entity1));
+    EXPECT_EQ(sut.QueryAll<ArchetypeAComponent>().Size(), 0);
+}
+
+TEST(ArchetypeRegistryTest, Emplace_MultipleComponent)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity{ 0 };
+
+    sut.Emplace<ArchetypeAComponent>(entity, 42);
+    sut.Emplace<ArchetypeBComponent>(entity, 1, "Test");
+
+    auto [actual1, actual2] =
+        sut.Get<ArchetypeAComponent, ArchetypeBComponent>(entity);
+
+    EXPECT_TRUE(sut.IsValid(entity));
+    EXPECT_EQ(actual1.number, 42);
+    EXPECT_EQ(actual2.number, 1);
+    EXPECT_STREQ(actual2.string, "Test");
+}
+
+TEST(ArchetypeRegistryTest, Emplace_SameSignature_SharesArchetype)
+{
+    ECS::ArchetypeRegistry sut;
+
+    ECS::Entity entity0 = sut.Create();
+    ECS::Entity entity1 = sut.Create();
+
+    sut.Emplace<ArchetypeAComponent>(entity0, 1);
+    sut.Emplace<ArchetypeBComponent>(entity0, 2, "Test");
+    sut.Emplace<ArchetypeBComponent>(entity1, 3, "Test");
+    sut.Emplace<ArchetypeAComponent>(entity1, 4);
+
+    // root, {A}, {A, B}, {B}
+    EXPECT_EQ(sut.ArchetypeCount(), 4);
+}
+
+TEST(ArchetypeRegistryTest, Emplace_MoveOnlyComponent_KeepsValue)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity = sut.Create();
+
+    sut.Emplace<ArchetypeCComponent>(
+        entity,
+        std::make_unique<std::string>("Test"));
+    sut.Emplace<ArchetypeAComponent>(entity, 1);
+
+    EXPECT_EQ(*sut.Get<ArchetypeCComponent>(entity).text, "Test");
+
+    sut.Erase<ArchetypeAComponent>(entity);
+
+    EXPECT_EQ(*sut.Get<ArchetypeCComponent>(entity).text, "Test");
+}
+
+TEST(ArchetypeRegistryTest, Emplace_FromOwnComponent_ReadsValue)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity = sut.Create();
+    const std::string text(100, 'x');
+
+    sut.Emplace<ArchetypeDComponent>(entity, text);
+
+    // The argument refers to the component the entity already holds.
+    sut.Emplace<ArchetypeEComponent>(
+        entity,
+        sut.Get<ArchetypeDComponent>(entity).text);
+
+    EXPECT_EQ(sut.Get<ArchetypeEComponent>(entity).copy, text);
+    EXPECT_EQ(sut.Get<ArchetypeDComponent>(entity).text, text);
+}
+
+TEST(ArchetypeRegistryTest, Patch_SingleComponent)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity = sut.Create<ArchetypeBComponent>(1, "Test");
+
+    auto& actual = sut.Patch<ArchetypeBComponent>(
+        entity,
+        [](ArchetypeBComponent& value) { value.number = 42; });
+
+    EXPECT_EQ(actual.number, 42);
+    EXPECT_EQ(sut.Get<ArchetypeBComponent>(entity).number, 42);
+}
+
+TEST(ArchetypeRegistryTest, AllOf_AnyOf_MultipleComponent)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity0 = sut.Create<ArchetypeAComponent>(1);
+    ECS::Entity entity1 = sut.Create<ArchetypeAComponent>(42);
+    sut.Emplace<ArchetypeBComponent>(entity1, 1, "Test");
+
+    EXPECT_FALSE(sut.AllOf<ArchetypeBComponent>(entity0));
+    EXPECT_TRUE(
+        (sut.AllOf<ArchetypeAComponent, ArchetypeBComponent>(entity1)));
+    EXPECT_FALSE((sut.AllOf<float, ArchetypeBComponent>(entity1)));
+    EXPECT_TRUE((sut.AnyOf<float, ArchetypeBComponent>(entity1)));
+    EXPECT_FALSE(sut.AnyOf<float>(entity1));
+    EXPECT_FALSE(sut.AllOf<ArchetypeAComponent>(2));
+}
+
+TEST(ArchetypeRegistryTest, Erase_MultipleComponents)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity0 = sut.Create<ArchetypeAComponent>(1);
+    ECS::Entity entity1 = sut.Create<ArchetypeAComponent>(42);
+    sut.Emplace<ArchetypeBComponent>(entity1, 1, "Test");
+
+    sut.Erase<ArchetypeAComponent>(entity0);
+    sut.Erase<ArchetypeAComponent, ArchetypeBComponent>(entity1);
+
+    EXPECT_TRUE(sut.IsValid(entity0));
+    EXPECT_TRUE(sut.IsValid(entity1));
+    EXPECT_FALSE(sut.AnyOf<ArchetypeAComponent>(entity0));
+    EXPECT_FALSE(
+        (sut.AnyOf<ArchetypeAComponent, ArchetypeBComponent>(entity1)));
+}
+
+TEST(ArchetypeRegistryTest, QueryAll_MultipleComponent_MatchingArchetypes)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity0 = sut.Create<ArchetypeAComponent>(1);
+    ECS::Entity entity1 = sut.Create<ArchetypeAComponent>(42);
+    sut.Emplace<ArchetypeBComponent>(entity1, 1, "Test");
+
+    auto query = sut.QueryAll<ArchetypeAComponent, ArchetypeBComponent>();
+
+    int count{ 0 };
+    query.Each([&](ArchetypeAComponent& a, ArchetypeBComponent& b) {
+        EXPECT_EQ(a.number, 42);
+        EXPECT_EQ(b.number, 1);
+        ++count;
+    });
+
+    EXPECT_EQ(count, 1);
+
+    sut.Emplace<ArchetypeBComponent>(entity0, 2, "Test");
+    sut.Emplace<float>(entity0, 1.f);
+
+    count = 0;
+    query.Each([&](ArchetypeAComponent&, ArchetypeBComponent&) { ++count; });
+
+    EXPECT_EQ(count, 2);
+}
+
+TEST(ArchetypeRegistryTest, QueryIterator_ManyChunks_VisitsAll)
+{
+    ECS::ArchetypeRegistry sut;
+    constexpr int count{ 10000 };
+
+    for (int i{ 0 }; i < count; ++i)
+    {
+        ECS::Entity entity = sut.Create<ArchetypeAComponent>(i);
+
+        if (i % 2 == 0)
+            sut.Emplace<ArchetypeBComponent>(entity, i, "Test");
+    }
+
+    auto query = sut.QueryAll<ArchetypeAComponent>();
+
+    long long sum{ 0 };
+    for (auto& value : query)
+    {
+        sum += value.number;
+        value.number = 0;
+    }
+
+    EXPECT_EQ(query.Size(), count);
+    EXPECT_EQ(sum, static_cast<long long>(count) * (count - 1) / 2);
+
+    for (auto [a, b] : sut.QueryAll<ArchetypeAComponent, ArchetypeBComponent>())
+    {
+        EXPECT_EQ(a.number, 0);
+        EXPECT_EQ(b.number % 2, 0);
+    }
+}
+
+TEST(ArchetypeRegistryTest, Destroy_StaleHandle_IsNotValid)
+{
+    ECS::ArchetypeRegistry sut;
+    ECS::Entity entity = sut.Create<ArchetypeAComponent>(1);
+
+    sut.Destroy(entity);
+    ECS::Entity actual = sut.Create<ArchetypeAComponent>(2);
+
+    EXPECT_EQ(ECS::entityIndex(actual), ECS::entityIndex(entity));
+    EXPECT_FALSE(sut.IsValid(entity));
+    EXPECT_FALSE(sut.AllOf<ArchetypeAComponent>(entity));
+    EXPECT_EQ(sut.Get<ArchetypeAComponent>(actual).number, 2);
+}
@@ -0,0 +1,104 @@
+#include <ecs/Archetype.hpp>
+#include <ecs/ComponentInfo.hpp>
+#include <ecs/Entity.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+struct ArchetypePosition
+{
+    float x, y, z;
+};
+
+struct alignas(16) ArchetypeAligned
+{
+    float value[4];
+};
+
+static std::vector<const Zeus::ECS::ComponentInfo*> SortedInfos()
+{
+    std::vector<const Zeus::ECS::ComponentInfo*> components{
+        &Zeus::ECS::ComponentInfo::Of<ArchetypePosition>(),
+        &Zeus::ECS::ComponentInfo::Of<ArchetypeAligned>(),
+    };
+
+    if (components[0]->family > components[1]->family)
+        std::swap(components[0], components[1]);
+
+    return components;
+}
+
+TEST(ArchetypeTest, Constructor_ChunkFitsLayout)
+{
+    Zeus::ECS::Archetype sut(SortedInfos());
+
+    auto capacity = sut.ChunkCapacity();
+    auto rowSize = sizeof(Zeus::ECS::Entity) + sizeof(ArchetypePosition) +
+                   sizeof(ArchetypeAligned);
+
+    EXPECT_TRUE(sut.Empty());
+    EXPECT_EQ(sut.ChunkCount(), 0);
+    EXPECT_GT(capacity, 0);
+    EXPECT_LE(capacity * rowSize, Zeus::ECS::Archetype::CHUNK_SIZE);
+}
+
+TEST(ArchetypeTest, Data_ColumnsAligned)
+{
+    Zeus::ECS::Archetype sut(SortedInfos());
+    sut.Allocate(0);
+
+    auto column = sut.Column(Zeus::FamilyId::Type<ArchetypeAligned>());
+    auto address = reinterpret_cast<std::uintptr_t>(sut.Data(0, column));
+
+    EXPECT_EQ(address % alignof(ArchetypeAligned), 0);
+    EXPECT_EQ(
+        sut.Column(Zeus::FamilyId::Type<int>()),
+        Zeus::ECS::Archetype::INVALID_COLUMN);
+
+    sut.Clear();
+}
+
+TEST(ArchetypeTest, Allocate_SpansMultipleChunks)
+{
+    Zeus::ECS::Archetype sut(SortedInfos());
+    auto capacity = sut.ChunkCapacity();
+    auto column = sut.Column(Zeus::FamilyId::Type<ArchetypePosition>());
+
+    for (Zeus::ECS::Entity entity{ 0 }; entity < capacity + 1; ++entity)
+    {
+        auto row = sut.Allocate(entity);
+        new (sut.At(column, row)) ArchetypePosition{ 1.f, 2.f, 3.f };
+        new (sut.At(1 - column, row)) ArchetypeAligned{};
+    }
+
+    EXPECT_EQ(sut.Size(), capacity + 1);
+    EXPECT_EQ(sut.ChunkCount(), 2);
+    EXPECT_EQ(sut.ChunkSize(0), capacity);
+    EXPECT_EQ(sut.ChunkSize(1), 1);
+    EXPECT_EQ(sut.Entities(1)[0], capacity);
+}
+
+TEST(ArchetypeTest, Remove_MovesLastRowIntoHole)
+{
+    Zeus::ECS::Archetype sut(SortedInfos());
+    auto column = sut.Column(Zeus::FamilyId::Type<ArchetypePosition>());
+
+    for (Zeus::ECS::Entity entity{ 0 }; entity < 3; ++entity)
+    {
+        auto row = sut.Allocate(entity);
+        new (sut.At(column, row))
+            ArchetypePosition{ static_cast<float>(entity), 0.f, 0.f };
+        new (sut.At(1 - column, row)) ArchetypeAligned{};
+    }
+
+    sut.Remove(0);
+
+    auto actual = static_cast<ArchetypePosition*>(sut.At(column, 0));
+
+    EXPECT_EQ(sut.Size(), 2);
+    EXPECT_EQ(sut.EntityAt(0), 2);
+    EXPECT_EQ(sut.EntityAt(1), 1);
+    EXPECT_EQ(actual->x, 2.f);
+}
@@ -0,0 +1,207 @@
+#include <core/JobSystem.hpp>
+#include <ecs/CommandBuffer.hpp>
+#include <ecs/Entity.hpp>
+#include <ecs/Registry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+struct CommandPosition
+{
+    float value;
+};
+
+struct CommandTag
+{
+    int value;
+};
+}
+
+TEST(CommandBufferTest, Create_Provisional_ResolvedOnPlayback)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+
+    ECS::Entity provisional = sut.Create();
+    sut.Emplace<CommandPosition>(provisional, 4);
+
+    EXPECT_EQ(
+        ECS::entityVersion(provisional),
+        ECS::ENTITY_PROVISIONAL_VERSION);
+    EXPECT_FALSE(registry.IsValid(provisional));
+    EXPECT_FALSE(sut.Empty());
+
+    sut.Playback(registry);
+
+    ECS::Entity entity = sut.Resolve(provisional);
+    EXPECT_TRUE(sut.Empty());
+    EXPECT_TRUE(registry.IsValid(entity));
+    EXPECT_EQ(registry.Get<CommandPosition>(entity).value, 4.0f);
+}
+
+TEST(CommandBufferTest, Playback_DuringIteration_Deferred)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+
+    for (int i{ 0 }; i < 10; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<CommandTag>(entity, static_cast<int>(entity));
+    }
+
+    registry.QueryAll<CommandTag>().Each([&](CommandTag& tag) {
+        const auto entity{ static_cast<ECS::Entity>(tag.value) };
+
+        if (tag.value % 2 == 0)
+            sut.Destroy(entity);
+        else
+            sut.Emplace<CommandPosition>(entity, 1);
+    });
+
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 10);
+
+    sut.Playback(registry);
+
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 5);
+    EXPECT_EQ(registry.QueryAll<CommandPosition>().Size(), 5);
+}
+
+TEST(CommandBufferTest, Playback_Erase)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+    ECS::Entity entity{ registry.Create() };
+    registry.Emplace<CommandPosition>(entity, 1);
+    registry.Emplace<CommandTag>(entity, 2);
+
+    sut.Erase<CommandPosition, CommandTag>(entity);
+    sut.Playback(registry);
+
+    EXPECT_TRUE(registry.IsValid(entity));
+    EXPECT_FALSE((registry.AnyOf<CommandPosition, CommandTag>(entity)));
+}
+
+TEST(CommandBufferTest, Playback_EmplaceExisting_Replaced)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+    ECS::Entity entity{ registry.Create() };
+    registry.Emplace<CommandTag>(entity, 1);
+
+    sut.Emplace<CommandTag>(entity, 2);
+    sut.Playback(registry);
+
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 1);
+    EXPECT_EQ(registry.Get<CommandTag>(entity).value, 2);
+}
+
+TEST(CommandBufferTest, Playback_DestroyedEntity_Skipped)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+    ECS::Entity entity{ registry.Create() };
+
+    sut.Emplace<CommandTag>(entity, 1);
+    sut.Destroy(entity);
+    sut.Destroy(entity);
+    registry.Destroy(entity);
+
+    sut.Playback(registry);
+
+    EXPECT_FALSE(registry.IsValid(entity));
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 0);
+}
+
+TEST(CommandBufferTest, Playback_RecordedOrder)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+
+    ECS::Entity destroyed{ sut.Create() };
+    ECS::Entity kept{ sut.Create() };
+
+    sut.Destroy(destroyed);
+    sut.Emplace<CommandTag>(destroyed, 1);
+    sut.Erase<CommandTag>(kept);
+    sut.Emplace<CommandTag>(kept, 2);
+    sut.Emplace<CommandPosition>(kept, 3);
+    sut.Erase<CommandPosition>(kept);
+
+    sut.Playback(registry);
+
+    EXPECT_FALSE(registry.IsValid(sut.Resolve(destroyed)));
+    EXPECT_TRUE(registry.IsValid(sut.Resolve(kept)));
+    EXPECT_TRUE(registry.AllOf<CommandTag>(sut.Resolve(kept)));
+    EXPECT_EQ(registry.Get<CommandTag>(sut.Resolve(kept)).value, 2);
+    EXPECT_FALSE(registry.AllOf<CommandPosition>(sut.Resolve(kept)));
+}
+
+TEST(CommandBufferTest, Record_FromJobs)
+{
+    JobSystem::Initialize(3);
+
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+
+    JobSystem::ParallelFor(
+        1000,
+        16,
+        [&](std::uint32_t begin, std::uint32_t end) {
+            for (std::uint32_t i{ begin }; i < end; ++i)
+            {
+                sut.Emplace<CommandTag>(sut.Create(), static_cast<int>(i));
+            }
+        });
+
+    JobSystem::Shutdown();
+
+    sut.Playback(registry);
+
+    std::vector<int> seen(1000, 0);
+    registry.QueryAll<CommandTag>().Each(
+        [&](CommandTag& tag) { ++seen[static_cast<std::size_t>(tag.value)]; });
+
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 1000);
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), 1000);
+}
+
+TEST(CommandBufferTest, Record_FromExternalThreads)
+{
+    ECS::Registry registry;
+    ECS::CommandBuffer sut;
+
+    std::vector<std::thread> threads{};
+    for (int t{ 0 }; t < 4; ++t)
+    {
+        threads.emplace_back([&sut, t]() {
+            for (int i{ 0 }; i < 250; ++i)
+            {
+                sut.Emplace<CommandTag>(sut.Create(), t * 250 + i);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    sut.Playback(registry);
+
+    std::vector<int> seen(1000, 0);
+    registry.QueryAll<CommandTag>().Each(
+        [&](CommandTag& tag) { ++seen[static_cast<std::size_t>(tag.value)]; });
+
+    EXPECT_EQ(registry.QueryAll<CommandTag>().Size(), 1000);
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), 1000);
+}
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 struct TestComponent
 {
     float x{}, y{};
@@ -179,3 +183,128 @@ TEST(ComponentSparseSetTest, Pop_EntityNotFound)
     EXPECT_EQ(actual.x, 1);
     EXPECT_EQ(actual.y, 2);
 }
+
+TEST(ComponentSparseSetTest, Swap_ComponentsFollowEntities)
+{
+    Zeus::ECS::ComponentSparseSet<TestComponent> sut;
+    Zeus::ECS::Entity entity1{ 0 };
+    Zeus::ECS::Entity entity2{ 1 };
+    sut.Emplace(entity1, TestComponent{ .x = 1, .y = 2 });
+    sut.Emplace(entity2, TestComponent{ .x = 3, .y = 4 });
+
+    sut.Swap(0, 1);
+
+    EXPECT_EQ(sut.Index(entity1), 1);
+    EXPECT_EQ(sut.Index(entity2), 0);
+    EXPECT_EQ(sut.Get(entity1).x, 1);
+    EXPECT_EQ(sut.Get(entity2).x, 3);
+    EXPECT_EQ(sut.Components()[0].x, 3);
+}
+
+TEST(ComponentSparseSetTest, Ticks_FollowSwapAndPop)
+{
+    std::uint32_t tick{ 1 };
+    Zeus::ECS::ComponentSparseSet<TestComponent> sut;
+    sut.BindTick(&tick);
+    sut.TrackRemovals();
+
+    sut.Emplace(0, TestComponent{ .x = 1, .y = 2 });
+    ++tick;
+    sut.Emplace(1, TestComponent{ .x = 3, .y = 4 });
+    ++tick;
+    sut.GetMutable(1).x = 5;
+
+    sut.Pop(0);
+
+    EXPECT_EQ(sut.AddedTick(1), 2);
+    EXPECT_EQ(sut.ChangedTick(1), 3);
+    ASSERT_EQ(sut.Removed().size(), 1);
+    EXPECT_EQ(sut.Removed()[0].entity, 0);
+    EXPECT_EQ(sut.Removed()[0].tick, 3);
+}
+
+struct TestTag
+{
+};
+
+TEST(ComponentSparseSetTest, Tag_StoresMembershipOnly)
+{
+    Zeus::ECS::ComponentSparseSet<TestTag> sut;
+    sut.Emplace(0);
+    sut.Emplace(5);
+    sut.Emplace(9);
+
+    sut.Pop(5);
+
+    EXPECT_TRUE(Zeus::ECS::ComponentSparseSet<TestTag>::IS_TAG);
+    EXPECT_EQ(sut.Size(), 2);
+    EXPECT_TRUE(sut.Contains(0));
+    EXPECT_FALSE(sut.Contains(5));
+    EXPECT_TRUE(sut.Contains(9));
+    EXPECT_EQ(&sut.Get(0), &sut.Get(9));
+    EXPECT_LT(
+        sizeof(Zeus::ECS::ComponentSparseSet<TestTag>),
+        sizeof(Zeus::ECS::ComponentSparseSet<TestComponent>));
+}
+
+TEST(ComponentSparseSetTest, EmplaceMany_GrowsOnce)
+{
+    Zeus::ECS::ComponentSparseSet<TestComponent> sut;
+    const std::vector<Zeus::ECS::Entity> entities{ 2, 0, 9 };
+    const std::vector<TestComponent> values{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+    sut.EmplaceMany(entities.begin(), entities.end(), values.begin());
+
+    EXPECT_EQ(sut.Size(), 3);
+    EXPECT_EQ(sut.Capacity(), 3);
+    EXPECT_EQ(sut.Get(0).x, 3);
+    EXPECT_EQ(sut.Get(9).y, 6);
+    EXPECT_EQ(sut.Index(9), 2);
+}
+
+TEST(ComponentSparseSetTest, Sort_PermutesEntitiesAndComponents)
+{
+    Zeus::ECS::ComponentSparseSet<TestComponent> sut;
+    const std::vector<float> keys{ 5, 1, 4, 2, 3, 0 };
+    for (std::size_t i{ 0 }; i < keys.size(); ++i)
+    {
+        sut.Emplace(static_cast<Zeus::ECS::Entity>(i * 3), keys[i], 0.0f);
+    }
+
+    sut.Sort([](const TestComponent& lhs, const TestComponent& rhs) {
+        return lhs.x < rhs.x;
+    });
+
+    for (std::size_t i{ 0 }; i < sut.Size(); ++i)
+    {
+        const Zeus::ECS::Entity entity{ sut.Data()[i] };
+
+        EXPECT_EQ(sut.Components()[i].x, static_cast<float>(i));
+        EXPECT_EQ(sut.Index(entity), i);
+        EXPECT_EQ(sut.Get(entity).x, keys[entity / 3]);
+    }
+}
+
+TEST(ComponentSparseSetTest, Sort_Insertion)
+{
+    Zeus::ECS::ComponentSparseSet<TestComponent> sut;
+    const std::vector<float> keys{ 0, 1, 3, 2, 4, 6, 5 };
+    for (std::size_t i{ 0 }; i < keys.size(); ++i)
+    {
+        sut.Emplace(static_cast<Zeus::ECS::Entity>(i), keys[i], 0.0f);
+    }
+
+    sut.Sort(
+        [](const TestComponent& lhs, const TestComponent& rhs) {
+            return lhs.x < rhs.x;
+        },
+        Zeus::ECS::SortMode::Insertion);
+
+    for (std::size_t i{ 0 }; i < sut.Size(); ++i)
+    {
+        const Zeus::ECS::Entity entity{ sut.Data()[i] };
+
+        EXPECT_EQ(sut.Components()[i].x, static_cast<float>(i));
+        EXPECT_EQ(sut.Get(entity).x, keys[entity]);
+    }
+}
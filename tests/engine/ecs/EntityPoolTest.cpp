@@ -0,0 +1,127 @@
+#include <ecs/Entity.hpp>
+#include <ecs/EntityPool.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Zeus;
+
+TEST(EntityPoolTest, Entity_PackIndexAndVersion)
+{
+    ECS::Entity entity = ECS::makeEntity(42, 3);
+
+    EXPECT_EQ(ECS::entityIndex(entity), 42);
+    EXPECT_EQ(ECS::entityVersion(entity), 3);
+    EXPECT_EQ(ECS::entityIndex(ECS::nextVersion(entity)), 42);
+    EXPECT_EQ(ECS::entityVersion(ECS::nextVersion(entity)), 4);
+}
+
+TEST(EntityPoolTest, Entity_VersionWrapsAround)
+{
+    ECS::Entity entity =
+        ECS::makeEntity(7, ECS::ENTITY_PROVISIONAL_VERSION - 1u);
+
+    auto actual = ECS::nextVersion(entity);
+
+    EXPECT_EQ(ECS::entityIndex(actual), 7);
+    EXPECT_EQ(ECS::entityVersion(actual), 0);
+}
+
+TEST(EntityPoolTest, Create_Sequential)
+{
+    ECS::EntityPool sut;
+
+    EXPECT_EQ(sut.Create(), 0);
+    EXPECT_EQ(sut.Create(), 1);
+    EXPECT_EQ(sut.Size(), 2);
+}
+
+TEST(EntityPoolTest, Destroy_RecyclesIndexWithNewVersion)
+{
+    ECS::EntityPool sut;
+    ECS::Entity entity0 = sut.Create();
+    sut.Create();
+
+    sut.Destroy(entity0);
+    ECS::Entity actual = sut.Create();
+
+    EXPECT_EQ(ECS::entityIndex(actual), ECS::entityIndex(entity0));
+    EXPECT_EQ(ECS::entityVersion(actual), 1);
+    EXPECT_FALSE(sut.IsValid(entity0));
+    EXPECT_TRUE(sut.IsValid(actual));
+    EXPECT_EQ(sut.Released(), 0);
+}
+
+TEST(EntityPoolTest, Insert_SkippedIndicesAreReleased)
+{
+    ECS::EntityPool sut;
+
+    sut.Insert(3);
+
+    EXPECT_TRUE(sut.IsValid(3));
+    EXPECT_EQ(sut.Released(), 3);
+
+    ECS::Entity entity0 = sut.Create();
+    ECS::Entity entity1 = sut.Create();
+    ECS::Entity entity2 = sut.Create();
+    ECS::Entity entity3 = sut.Create();
+
+    EXPECT_LT(entity0, 3);
+    EXPECT_LT(entity1, 3);
+    EXPECT_LT(entity2, 3);
+    EXPECT_EQ(entity3, 4);
+}
+
+TEST(EntityPoolTest, Insert_ReleasedIndex)
+{
+    ECS::EntityPool sut;
+    ECS::Entity entity = sut.Create();
+    sut.Destroy(entity);
+
+    sut.Insert(ECS::nextVersion(entity));
+
+    EXPECT_TRUE(sut.IsValid(ECS::nextVersion(entity)));
+    EXPECT_EQ(sut.Released(), 0);
+    EXPECT_EQ(sut.Create(), 1);
+}
+
+TEST(EntityPoolTest, IsIssued_DestroyedHandleIsStale)
+{
+    ECS::EntityPool sut;
+    ECS::Entity entity = sut.Create();
+
+    sut.Destroy(entity);
+
+    EXPECT_FALSE(sut.IsValid(entity));
+    EXPECT_TRUE(sut.IsIssued(entity));
+    EXPECT_FALSE(sut.IsIssued(1));
+}
+
+TEST(EntityPoolTest, Clear_InvalidatesHandles)
+{
+    ECS::EntityPool sut;
+    ECS::Entity entity0 = sut.Create();
+    ECS::Entity entity1 = sut.Create();
+
+    sut.Clear();
+
+    EXPECT_FALSE(sut.IsValid(entity0));
+    EXPECT_FALSE(sut.IsValid(entity1));
+    EXPECT_EQ(sut.Size(), 0);
+    EXPECT_EQ(sut.Released(), 2);
+}
+
+TEST(EntityPoolTest, Assign_ReleasesMissingIndices)
+{
+    ECS::EntityPool sut;
+    sut.Create();
+
+    sut.Assign({ ECS::makeEntity(3, 2), ECS::makeEntity(1, 0) });
+
+    EXPECT_EQ(sut.Size(), 2);
+    EXPECT_TRUE(sut.IsValid(ECS::makeEntity(3, 2)));
+    EXPECT_TRUE(sut.IsValid(ECS::makeEntity(1, 0)));
+    EXPECT_EQ(sut.Released(), 2);
+    EXPECT_EQ(sut.Create(), 0);
+    EXPECT_EQ(sut.Create(), 2);
+    EXPECT_EQ(sut.Create(), 4);
+}
@@ -2,15 +2,23 @@
 
 #include <gtest/gtest.h>
 
+struct FamilyIdTestA
+{
+};
+
+struct FamilyIdTestB
+{
+};
+
 TEST(FamilyIdTest, Type_IdPerType)
 {
-    auto idInt1 = Zeus::FamilyId::Type<int>();
-    auto idInt2 = Zeus::FamilyId::Type<int>();
+    // Ids are process wide, other tests may have registered types already.
+    auto idA1 = Zeus::FamilyId::Type<FamilyIdTestA>();
+    auto idA2 = Zeus::FamilyId::Type<FamilyIdTestA>();
 
-    auto idFloat1 = Zeus::FamilyId::Type<float>();
+    auto idB1 = Zeus::FamilyId::Type<FamilyIdTestB>();
 
-    EXPECT_EQ(idInt1, 0);
-    EXPECT_EQ(idInt2, 0);
+    EXPECT_EQ(idA1, idA2);
 
-    EXPECT_EQ(idFloat1, 1);
+    EXPECT_EQ(idB1, idA1 + 1);
 }
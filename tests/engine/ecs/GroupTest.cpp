@@ -0,0 +1,183 @@
+#include <ecs/Entity.hpp>
+#include <ecs/Group.hpp>
+#include <ecs/Registry.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+using namespace Zeus;
+
+namespace
+{
+struct GroupPosition
+{
+    int value;
+};
+
+struct GroupVelocity
+{
+    int value;
+};
+
+struct GroupTag
+{
+    int value;
+};
+
+// Owned pools have to agree on the entity at every group position.
+void ExpectPacked(
+    ECS::Registry& registry,
+    ECS::Group<GroupPosition, GroupVelocity>& group)
+{
+    std::size_t index{ 0 };
+    group.Each([&](GroupPosition& position, GroupVelocity& velocity) {
+        const ECS::Entity entity{ group.Entities()[index++] };
+
+        EXPECT_EQ(&position, &registry.Get<GroupPosition>(entity));
+        EXPECT_EQ(&velocity, &registry.Get<GroupVelocity>(entity));
+        EXPECT_EQ(position.value, velocity.value);
+    });
+
+    EXPECT_EQ(index, group.Size());
+}
+}
+
+TEST(GroupTest, Group_PacksExistingEntities)
+{
+    ECS::Registry registry;
+
+    for (int i{ 0 }; i < 10; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<GroupPosition>(entity, i);
+
+        if (i % 3 == 0)
+            registry.Emplace<GroupVelocity>(entity, i);
+    }
+
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    EXPECT_EQ(sut.Size(), 4);
+    ExpectPacked(registry, sut);
+}
+
+TEST(GroupTest, Emplace_JoinsGroup)
+{
+    ECS::Registry registry;
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    ECS::Entity loose{ registry.Create() };
+    registry.Emplace<GroupPosition>(loose, 1);
+
+    ECS::Entity entity{ registry.Create() };
+    registry.Emplace<GroupPosition>(entity, 2);
+    auto& velocity = registry.Emplace<GroupVelocity>(entity, 2);
+
+    EXPECT_EQ(sut.Size(), 1);
+    EXPECT_TRUE(sut.Contains(entity));
+    EXPECT_FALSE(sut.Contains(loose));
+    EXPECT_EQ(&velocity, &registry.Get<GroupVelocity>(entity));
+    ExpectPacked(registry, sut);
+}
+
+TEST(GroupTest, Erase_LeavesGroup)
+{
+    ECS::Registry registry;
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    ECS::Entity entities[4];
+    for (int i{ 0 }; i < 4; ++i)
+    {
+        entities[i] = registry.Create();
+        registry.Emplace<GroupPosition>(entities[i], i);
+        registry.Emplace<GroupVelocity>(entities[i], i);
+    }
+
+    registry.Erase<GroupVelocity>(entities[1]);
+    registry.Erase<GroupPosition>(entities[2]);
+
+    EXPECT_EQ(sut.Size(), 2);
+    EXPECT_FALSE(sut.Contains(entities[1]));
+    EXPECT_FALSE(sut.Contains(entities[2]));
+    EXPECT_TRUE(registry.AllOf<GroupPosition>(entities[1]));
+    EXPECT_EQ(registry.Get<GroupPosition>(entities[1]).value, 1);
+    ExpectPacked(registry, sut);
+}
+
+TEST(GroupTest, Destroy_LeavesGroup)
+{
+    ECS::Registry registry;
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    ECS::Entity first{ registry.Create() };
+    registry.Emplace<GroupPosition>(first, 1);
+    registry.Emplace<GroupVelocity>(first, 1);
+    registry.Emplace<GroupTag>(first, 1);
+
+    ECS::Entity second{ registry.Create() };
+    registry.Emplace<GroupPosition>(second, 2);
+    registry.Emplace<GroupVelocity>(second, 2);
+
+    registry.Destroy(first);
+
+    EXPECT_EQ(sut.Size(), 1);
+    EXPECT_TRUE(sut.Contains(second));
+    ExpectPacked(registry, sut);
+}
+
+TEST(GroupTest, Group_SameOwnedComponents_SharesState)
+{
+    ECS::Registry registry;
+    auto first = registry.Group<GroupPosition, GroupVelocity>();
+    auto second = registry.Group<GroupVelocity, GroupPosition>();
+
+    ECS::Entity entity{ registry.Create() };
+    registry.Emplace<GroupVelocity>(entity, 3);
+    registry.Emplace<GroupPosition>(entity, 3);
+
+    EXPECT_EQ(first.Size(), 1);
+    EXPECT_EQ(second.Size(), 1);
+}
+
+TEST(GroupTest, Clear_EmptiesGroup)
+{
+    ECS::Registry registry;
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    ECS::Entity entity{ registry.Create() };
+    registry.Emplace<GroupPosition>(entity, 3);
+    registry.Emplace<GroupVelocity>(entity, 3);
+
+    registry.Clear();
+
+    EXPECT_TRUE(sut.Empty());
+}
+
+TEST(GroupTest, Each_ModifiesComponents)
+{
+    ECS::Registry registry;
+    auto sut = registry.Group<GroupPosition, GroupVelocity>();
+
+    for (int i{ 0 }; i < 100; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<GroupVelocity>(entity, i);
+
+        if (i % 2 == 0)
+            registry.Emplace<GroupPosition>(entity, 0);
+    }
+
+    sut.Each([](GroupPosition& position, GroupVelocity& velocity) {
+        position.value += velocity.value;
+    });
+
+    EXPECT_EQ(sut.Size(), 50);
+    for (std::size_t i{ 0 }; i < sut.Size(); ++i)
+    {
+        const ECS::Entity entity{ sut.Entities()[i] };
+        EXPECT_EQ(
+            registry.Get<GroupPosition>(entity).value,
+            registry.Get<GroupVelocity>(entity).value);
+    }
+}
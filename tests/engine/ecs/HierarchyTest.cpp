@@ -0,0 +1,170 @@
+#include <core/JobSystem.hpp>
+#include <ecs/Entity.hpp>
+#include <ecs/Hierarchy.hpp>
+#include <math/definitions.hpp>
+#include <math/transformations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+Math::Matrix4x4f Scale(float scale)
+{
+    return Math::uniformScale<float>(scale);
+}
+
+std::vector<ECS::Entity> Order(const ECS::Hierarchy& hierarchy)
+{
+    return { hierarchy.Data(), hierarchy.Data() + hierarchy.Size() };
+}
+
+constexpr ECS::Entity NO_PARENT{ ECS::Hierarchy::NO_PARENT };
+}
+
+TEST(HierarchyTest, Insert_KeepsDepthFirstOrder)
+{
+    ECS::Hierarchy sut;
+
+    sut.Insert(0, NO_PARENT, Scale(1));
+    sut.Insert(1, NO_PARENT, Scale(1));
+    sut.Insert(2, 0, Scale(1));
+    sut.Insert(3, 2, Scale(1));
+    sut.Insert(4, 0, Scale(1));
+
+    EXPECT_EQ(Order(sut), (std::vector<ECS::Entity>{ 0, 2, 3, 4, 1 }));
+    EXPECT_EQ(sut.Parent(3), 2);
+    EXPECT_EQ(sut.Parent(4), 0);
+    EXPECT_EQ(sut.Parent(1), NO_PARENT);
+    EXPECT_EQ(sut.SubtreeSize(0), 4);
+}
+
+TEST(HierarchyTest, Propagate_ComposesParents)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(2));
+    sut.Insert(1, 0, Scale(3));
+    sut.Insert(2, 1, Scale(5));
+
+    sut.Propagate();
+
+    EXPECT_EQ(sut.World(0)[0][0], 2);
+    EXPECT_EQ(sut.World(1)[0][0], 6);
+    EXPECT_EQ(sut.World(2)[0][0], 30);
+}
+
+TEST(HierarchyTest, SetLocal_UpdatesDescendantsOnly)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(2));
+    sut.Insert(1, 0, Scale(3));
+    sut.Insert(2, 1, Scale(5));
+    sut.Insert(3, 0, Scale(7));
+    sut.Propagate();
+
+    sut.SetLocal(1, Scale(1));
+    sut.Propagate();
+
+    EXPECT_EQ(sut.World(0)[0][0], 2);
+    EXPECT_EQ(sut.World(1)[0][0], 2);
+    EXPECT_EQ(sut.World(2)[0][0], 10);
+    EXPECT_EQ(sut.World(3)[0][0], 14);
+}
+
+TEST(HierarchyTest, Remove_RemovesDescendants)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(1));
+    sut.Insert(1, 0, Scale(1));
+    sut.Insert(2, 1, Scale(1));
+    sut.Insert(3, 0, Scale(1));
+    sut.Insert(4, NO_PARENT, Scale(1));
+
+    sut.Remove(1);
+
+    EXPECT_EQ(Order(sut), (std::vector<ECS::Entity>{ 0, 3, 4 }));
+    EXPECT_FALSE(sut.Contains(1));
+    EXPECT_FALSE(sut.Contains(2));
+    EXPECT_EQ(sut.Parent(3), 0);
+    EXPECT_EQ(sut.SubtreeSize(0), 2);
+}
+
+TEST(HierarchyTest, SetParent_MovesSubtree)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(2));
+    sut.Insert(1, 0, Scale(3));
+    sut.Insert(2, 1, Scale(5));
+    sut.Insert(3, 0, Scale(1));
+    sut.Insert(4, NO_PARENT, Scale(7));
+    sut.Propagate();
+
+    sut.SetParent(1, 4);
+    sut.Propagate();
+
+    EXPECT_EQ(Order(sut), (std::vector<ECS::Entity>{ 0, 3, 4, 1, 2 }));
+    EXPECT_EQ(sut.Parent(1), 4);
+    EXPECT_EQ(sut.Parent(2), 1);
+    EXPECT_EQ(sut.SubtreeSize(0), 2);
+    EXPECT_EQ(sut.SubtreeSize(4), 3);
+    EXPECT_EQ(sut.World(2)[0][0], 105);
+}
+
+TEST(HierarchyTest, SetParent_Backwards)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(2));
+    sut.Insert(1, NO_PARENT, Scale(3));
+    sut.Insert(2, 1, Scale(5));
+
+    sut.SetParent(2, 0);
+    sut.SetParent(1, 2);
+    sut.Propagate();
+
+    EXPECT_EQ(Order(sut), (std::vector<ECS::Entity>{ 0, 2, 1 }));
+    EXPECT_EQ(sut.SubtreeSize(0), 3);
+    EXPECT_EQ(sut.World(1)[0][0], 30);
+}
+
+TEST(HierarchyTest, SetParent_ToRoot)
+{
+    ECS::Hierarchy sut;
+    sut.Insert(0, NO_PARENT, Scale(2));
+    sut.Insert(1, 0, Scale(3));
+    sut.Insert(2, 0, Scale(5));
+
+    sut.SetParent(1, NO_PARENT);
+    sut.Propagate();
+
+    EXPECT_EQ(Order(sut), (std::vector<ECS::Entity>{ 0, 2, 1 }));
+    EXPECT_EQ(sut.Parent(1), NO_PARENT);
+    EXPECT_EQ(sut.World(1)[0][0], 3);
+}
+
+TEST(HierarchyTest, Propagate_ParallelRoots)
+{
+    JobSystem::Initialize(3);
+
+    ECS::Hierarchy sut;
+    for (ECS::Entity root{ 0 }; root < 400; root += 4)
+    {
+        sut.Insert(root, NO_PARENT, Scale(2));
+        sut.Insert(root + 1, root, Scale(3));
+        sut.Insert(root + 2, root + 1, Scale(5));
+        sut.Insert(root + 3, root, Scale(7));
+    }
+
+    sut.Propagate(4);
+
+    JobSystem::Shutdown();
+
+    for (ECS::Entity root{ 0 }; root < 400; root += 4)
+    {
+        EXPECT_EQ(sut.World(root + 2)[0][0], 30);
+        EXPECT_EQ(sut.World(root + 3)[0][0], 14);
+    }
+}
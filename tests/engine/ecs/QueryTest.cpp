@@ -4,6 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 using namespace Zeus;
 
 struct TestComponent1
@@ -172,3 +176,257 @@ TEST(
     ++actual;
     EXPECT_EQ(actual, query.end());
 }
+
+TEST(QueryTest, QueryIterator_Begin_SkipsNonMatching)
+{
+    ECS::Registry sut;
+
+    sut.Emplace<TestComponent1>(0, 1);
+    sut.Emplace<TestComponent1>(1, 2);
+    sut.Emplace<TestComponent2>(1, 42, "Test");
+    sut.Emplace<TestComponent2>(2, 43, "Test");
+    sut.Emplace<TestComponent2>(3, 44, "Test");
+
+    auto query = sut.QueryAll<TestComponent1, TestComponent2>();
+
+    int count{ 0 };
+    for (auto [a, b] : query)
+    {
+        EXPECT_EQ(a.value, 2);
+        EXPECT_EQ(b.value, 42);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 1);
+}
+
+TEST(QueryTest, Slice_VisitsOnlyRange)
+{
+    ECS::Registry sut;
+
+    for (ECS::Entity entity{ 0 }; entity < 10; ++entity)
+        sut.Emplace<TestComponent1>(entity, static_cast<float>(entity));
+
+    auto query = sut.QueryAll<TestComponent1>();
+
+    float sum{ 0 };
+    for (auto& value : query.Slice(2, 5))
+    {
+        sum += value.value;
+    }
+
+    EXPECT_EQ(query.Size(), 10);
+    EXPECT_EQ(sum, 2 + 3 + 4);
+}
+
+TEST(QueryTest, ParallelEach_MultipleComponents)
+{
+    JobSystem::Initialize(3);
+
+    ECS::Registry sut;
+    constexpr ECS::Entity count{ 5000 };
+
+    for (ECS::Entity entity{ 0 }; entity < count; ++entity)
+    {
+        sut.Emplace<TestComponent1>(entity, 1.f);
+
+        if (entity % 2 == 0)
+            sut.Emplace<TestComponent2>(entity, 0, "Test");
+    }
+
+    auto query = sut.QueryAll<TestComponent1, TestComponent2>();
+    query.ParallelEach(
+        [](TestComponent1& a, TestComponent2& b) {
+            b.value = static_cast<int>(a.value) + 1;
+        },
+        128);
+
+    JobSystem::Shutdown();
+
+    int matches{ 0 };
+    query.Each([&](TestComponent1&, TestComponent2& b) {
+        EXPECT_EQ(b.value, 2);
+        ++matches;
+    });
+
+    EXPECT_EQ(matches, count / 2);
+}
+
+TEST(QueryTest, Changed_OnlyModifiedSinceTick)
+{
+    ECS::Registry sut;
+
+    for (ECS::Entity entity{ 0 }; entity < 10; ++entity)
+        sut.Emplace<TestComponent1>(entity, static_cast<float>(entity));
+
+    const std::uint32_t lastRun{ sut.Tick() };
+    sut.AdvanceTick();
+
+    sut.GetMutable<TestComponent1>(3).value = 30;
+    sut.Patch<TestComponent1>(7, [](auto& component) { component.value = 70; });
+    sut.Get<TestComponent1>(5).value = 50;
+
+    std::vector<float> changed{};
+    sut.QueryAll<ECS::Changed<TestComponent1>>().Since(lastRun).Each(
+        [&](TestComponent1& component) { changed.push_back(component.value); });
+
+    std::sort(changed.begin(), changed.end());
+    EXPECT_EQ(changed, (std::vector<float>{ 30, 70 }));
+    EXPECT_EQ(sut.QueryAll<ECS::Changed<TestComponent1>>().Size(), 10);
+}
+
+TEST(QueryTest, Added_WithOtherComponents)
+{
+    ECS::Registry sut;
+
+    for (ECS::Entity entity{ 0 }; entity < 4; ++entity)
+    {
+        sut.Emplace<TestComponent1>(entity, static_cast<float>(entity));
+        sut.Emplace<TestComponent2>(entity, 0, "Old");
+    }
+
+    const std::uint32_t lastRun{ sut.Tick() };
+    sut.AdvanceTick();
+
+    sut.Emplace<TestComponent1>(4, 4.f);
+    sut.Emplace<TestComponent2>(4, 0, "New");
+    sut.GetMutable<TestComponent1>(0).value = 10;
+
+    auto query = sut.QueryAll<TestComponent1, ECS::Added<TestComponent2>>()
+                     .Since(lastRun);
+
+    int matches{ 0 };
+    for (auto [component1, component2] : query)
+    {
+        EXPECT_EQ(component1.value, 4.f);
+        EXPECT_STREQ(component2.text, "New");
+        ++matches;
+    }
+
+    EXPECT_EQ(matches, 1);
+}
+
+TEST(QueryTest, Without_ExcludesEntities)
+{
+    ECS::Registry sut;
+
+    for (ECS::Entity entity{ 0 }; entity < 10; ++entity)
+    {
+        sut.Emplace<TestComponent1>(entity, static_cast<float>(entity));
+
+        if (entity % 3 == 0)
+            sut.Emplace<TestComponent2>(entity, 0, "Excluded");
+    }
+
+    std::vector<float> values{};
+    sut.QueryAll<TestComponent1, ECS::Without<TestComponent2>>().Each(
+        [&](TestComponent1& component) { values.push_back(component.value); });
+
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<float>{ 1, 2, 4, 5, 7, 8 }));
+}
+
+TEST(QueryTest, Optional_YieldsPointer)
+{
+    ECS::Registry sut;
+    sut.Emplace<TestComponent1>(0, 1.f);
+    sut.Emplace<TestComponent1>(1, 2.f);
+    sut.Emplace<TestComponent2>(1, 42, "Optional");
+
+    auto query = sut.QueryAll<TestComponent1, ECS::Optional<TestComponent2>>();
+
+    int matches{ 0 };
+    for (auto [component1, component2] : query)
+    {
+        if (component1.value == 1.f)
+        {
+            EXPECT_EQ(component2, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(component2, nullptr);
+            EXPECT_EQ(component2->value, 42);
+        }
+
+        ++matches;
+    }
+
+    EXPECT_EQ(matches, 2);
+}
+
+TEST(QueryTest, Without_DoesNotDrive)
+{
+    ECS::Registry sut;
+    sut.Emplace<TestComponent2>(0, 1, "Excluded");
+    sut.Emplace<TestComponent2>(1, 1, "Excluded");
+    sut.Emplace<TestComponent1>(2, 3.f);
+
+    auto query = sut.QueryAll<ECS::Without<TestComponent2>, TestComponent1>();
+
+    int matches{ 0 };
+    query.Each([&](TestComponent1& component) {
+        EXPECT_EQ(component.value, 3.f);
+        ++matches;
+    });
+
+    EXPECT_EQ(query.Size(), 1);
+    EXPECT_EQ(matches, 1);
+}
+
+struct TestTag
+{
+};
+
+TEST(QueryTest, Tag_FiltersWithoutArgument)
+{
+    ECS::Registry sut;
+
+    for (ECS::Entity entity{ 0 }; entity < 6; ++entity)
+    {
+        sut.Emplace<TestComponent1>(entity, static_cast<float>(entity));
+
+        if (entity % 2 == 0)
+            sut.Emplace<TestTag>(entity);
+    }
+
+    float sum{ 0 };
+    sut.QueryAll<TestComponent1, TestTag>().Each(
+        [&](TestComponent1& component) { sum += component.value; });
+
+    int tagged{ 0 };
+    for ([[maybe_unused]] auto arguments : sut.QueryAll<TestTag>())
+    {
+        ++tagged;
+    }
+
+    EXPECT_EQ(sum, 0 + 2 + 4);
+    EXPECT_EQ(tagged, 3);
+}
+
+TEST(QueryTest, Optional_SingleArgument_RangeFor)
+{
+    ECS::Registry sut;
+    sut.Emplace<TestTag>(0);
+    sut.Emplace<TestTag>(1);
+    sut.Emplace<TestComponent2>(1, 42, "Optional");
+
+    // The tag yields no argument, the optional pointer is the only one.
+    auto query = sut.QueryAll<TestTag, ECS::Optional<TestComponent2>>();
+
+    int present{ 0 };
+    int missing{ 0 };
+    for (TestComponent2* component : query)
+    {
+        if (component == nullptr)
+        {
+            ++missing;
+            continue;
+        }
+
+        EXPECT_EQ(component->value, 42);
+        ++present;
+    }
+
+    EXPECT_EQ(present, 1);
+    EXPECT_EQ(missing, 1);
+}
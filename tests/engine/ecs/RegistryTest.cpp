@@ -1,8 +1,17 @@
 #include <ecs/Entity.hpp>
 #include <ecs/Registry.hpp>
+#include <memory/MemoryResource.hpp>
+#include <memory/TlsfAllocator.hpp>
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <vector>
+
 using namespace Zeus;
 
 struct AComponent
@@ -386,3 +395,371 @@ TEST(RegistryTest, IsValid)
     EXPECT_TRUE(actual1);
     EXPECT_FALSE(actual2);
 }
+
+TEST(RegistryTest, Destroy_StaleHandle_IsNotValid)
+{
+    ECS::Registry sut;
+    ECS::Entity entity = sut.Create<AComponent>(1);
+
+    sut.Destroy(entity);
+    ECS::Entity actual = sut.Create<AComponent>(2);
+
+    EXPECT_EQ(ECS::entityIndex(actual), ECS::entityIndex(entity));
+    EXPECT_FALSE(sut.IsValid(entity));
+    EXPECT_FALSE(sut.AllOf<AComponent>(entity));
+    EXPECT_TRUE(sut.IsValid(actual));
+    EXPECT_EQ(sut.Get<AComponent>(actual).number, 2);
+}
+
+TEST(RegistryTest, Create_AfterEmplace_DoesNotAlias)
+{
+    ECS::Registry sut;
+    ECS::Entity entity0{ 0 };
+
+    sut.Emplace<AComponent>(entity0, 1);
+    ECS::Entity actual = sut.Create();
+
+    EXPECT_NE(actual, entity0);
+    EXPECT_TRUE(sut.IsValid(entity0));
+    EXPECT_TRUE(sut.IsValid(actual));
+}
+
+TEST(RegistryTest, EachRemoved_SinceTick)
+{
+    ECS::Registry sut;
+    sut.TrackRemoved<AComponent>();
+
+    ECS::Entity entity0 = sut.Create<AComponent>(1);
+    ECS::Entity entity1 = sut.Create<AComponent>(2);
+    ECS::Entity entity2 = sut.Create<AComponent>(3);
+
+    sut.Erase<AComponent>(entity0);
+    const std::uint32_t lastRun{ sut.Tick() };
+    sut.AdvanceTick();
+
+    sut.Erase<AComponent>(entity1);
+    sut.Destroy(entity2);
+
+    std::vector<ECS::Entity> removed{};
+    sut.EachRemoved<AComponent>(lastRun, [&](ECS::Entity entity) {
+        removed.push_back(entity);
+    });
+
+    EXPECT_EQ(removed, (std::vector<ECS::Entity>{ entity1, entity2 }));
+
+    sut.TrimRemoved<AComponent>(sut.Tick());
+    removed.clear();
+    sut.EachRemoved<AComponent>(0, [&](ECS::Entity entity) {
+        removed.push_back(entity);
+    });
+
+    EXPECT_TRUE(removed.empty());
+}
+
+TEST(RegistryTest, EachRemoved_Untracked_KeepsNone)
+{
+    ECS::Registry sut;
+
+    for (int i{ 0 }; i < 100; ++i)
+        sut.Destroy(sut.Create<AComponent>(i));
+
+    int removed{ 0 };
+    sut.EachRemoved<AComponent>(0, [&](ECS::Entity) { ++removed; });
+    EXPECT_EQ(removed, 0);
+
+    sut.Destroy(sut.Create<AComponent>(1));
+    sut.EachRemoved<AComponent>(0, [&](ECS::Entity) { ++removed; });
+    EXPECT_EQ(removed, 1);
+}
+
+TEST(RegistryTest, CreateMany_WritesHandles)
+{
+    ECS::Registry sut;
+    std::vector<ECS::Entity> entities{};
+
+    sut.CreateMany(5, std::back_inserter(entities));
+
+    ASSERT_EQ(entities.size(), 5);
+    for (const ECS::Entity entity : entities)
+        EXPECT_TRUE(sut.IsValid(entity));
+}
+
+TEST(RegistryTest, EmplaceMany_Value)
+{
+    ECS::Registry sut;
+    std::vector<ECS::Entity> entities(4);
+    sut.CreateMany(entities.size(), entities.begin());
+
+    sut.EmplaceMany<AComponent>(
+        entities.begin(),
+        entities.end(),
+        AComponent{ 7 });
+
+    for (const ECS::Entity entity : entities)
+        EXPECT_EQ(sut.Get<AComponent>(entity).number, 7);
+}
+
+TEST(RegistryTest, EmplaceMany_Values)
+{
+    ECS::Registry sut;
+    std::vector<ECS::Entity> entities{ sut.Create(), sut.Create() };
+    sut.Emplace<AComponent>(sut.Create(), 0);
+
+    const std::vector<AComponent> values{ { 1 }, { 2 } };
+    sut.EmplaceMany<AComponent>(
+        entities.begin(),
+        entities.end(),
+        values.begin());
+
+    EXPECT_EQ(sut.Get<AComponent>(entities[0]).number, 1);
+    EXPECT_EQ(sut.Get<AComponent>(entities[1]).number, 2);
+    EXPECT_EQ(sut.QueryAll<AComponent>().Size(), 3);
+}
+
+TEST(RegistryTest, EmplaceMany_InsertsUnknownEntities)
+{
+    ECS::Registry sut;
+    const std::vector<ECS::Entity> entities{ 3, 5 };
+
+    sut.EmplaceMany<AComponent>(entities.begin(), entities.end());
+
+    EXPECT_TRUE(sut.IsValid(3));
+    EXPECT_TRUE(sut.IsValid(5));
+    EXPECT_TRUE(sut.AllOf<AComponent>(5));
+}
+
+TEST(RegistryTest, EmplaceMany_JoinsGroup)
+{
+    ECS::Registry sut;
+    auto group{ sut.Group<AComponent, BComponent>() };
+    std::vector<ECS::Entity> entities(3);
+    sut.CreateMany(entities.size(), entities.begin());
+
+    sut.EmplaceMany<AComponent>(entities.begin(), entities.end());
+    sut.EmplaceMany<BComponent>(entities.begin(), entities.end() - 1);
+
+    EXPECT_EQ(group.Size(), 2);
+}
+
+TEST(RegistryTest, DestroyMany_RemovesComponents)
+{
+    ECS::Registry sut;
+    std::vector<ECS::Entity> entities(6);
+    sut.CreateMany(entities.size(), entities.begin());
+    sut.EmplaceMany<AComponent>(entities.begin(), entities.end());
+    sut.EmplaceMany<BComponent>(entities.begin(), entities.begin() + 3);
+
+    sut.DestroyMany(entities.begin() + 1, entities.begin() + 4);
+
+    EXPECT_TRUE(sut.IsValid(entities[0]));
+    EXPECT_FALSE(sut.IsValid(entities[2]));
+    EXPECT_TRUE(sut.IsValid(entities[4]));
+    EXPECT_EQ(sut.QueryAll<AComponent>().Size(), 3);
+    EXPECT_EQ(sut.QueryAll<BComponent>().Size(), 1);
+}
+
+TEST(RegistryTest, DestroyMany_LeavesGroup)
+{
+    ECS::Registry sut;
+    auto group{ sut.Group<AComponent, BComponent>() };
+    std::vector<ECS::Entity> entities(4);
+    sut.CreateMany(entities.size(), entities.begin());
+    sut.EmplaceMany<AComponent>(entities.begin(), entities.end());
+    sut.EmplaceMany<BComponent>(entities.begin(), entities.end());
+
+    sut.DestroyMany(entities.begin(), entities.begin() + 2);
+
+    EXPECT_EQ(group.Size(), 2);
+    EXPECT_TRUE(group.Contains(entities[3]));
+}
+
+TEST(RegistryTest, Instantiate_CopiesComponents)
+{
+    struct Tag
+    {
+    };
+
+    ECS::Registry sut;
+    const ECS::Entity prefab{ sut.Create() };
+    sut.Emplace<AComponent>(prefab, 7);
+    sut.Emplace<Tag>(prefab);
+    sut.Emplace<BComponent>(sut.Create(), 1, "other");
+
+    std::vector<ECS::Entity> instances(3);
+    sut.Instantiate(prefab, instances.size(), instances.begin());
+
+    for (const ECS::Entity instance : instances)
+    {
+        EXPECT_NE(instance, prefab);
+        EXPECT_EQ(sut.Get<AComponent>(instance).number, 7);
+        EXPECT_TRUE(sut.AllOf<Tag>(instance));
+        EXPECT_FALSE(sut.AllOf<BComponent>(instance));
+    }
+}
+
+TEST(RegistryTest, Instantiate_BackInserter)
+{
+    ECS::Registry sut;
+    const ECS::Entity prefab{ sut.Create<AComponent>(3) };
+
+    std::vector<ECS::Entity> instances{};
+    sut.Instantiate(prefab, 2, std::back_inserter(instances));
+
+    ASSERT_EQ(instances.size(), 2);
+    EXPECT_EQ(sut.Get<AComponent>(instances[1]).number, 3);
+    EXPECT_EQ(sut.QueryAll<AComponent>().Size(), 3);
+}
+
+TEST(RegistryTest, Instantiate_MoveOnlyComponent_CreatesNothing)
+{
+    ECS::Registry sut;
+    const ECS::Entity prefab{ sut.Create<AComponent>(1) };
+    sut.Emplace<std::unique_ptr<int>>(prefab, std::make_unique<int>(2));
+    std::vector<ECS::Entity> instances{};
+
+    sut.Instantiate(prefab, 3, std::back_inserter(instances));
+
+    EXPECT_TRUE(instances.empty());
+    EXPECT_EQ(sut.QueryAll<AComponent>().Size(), 1);
+}
+
+TEST(RegistryTest, Instantiate_JoinsGroup)
+{
+    ECS::Registry sut;
+    auto group{ sut.Group<AComponent, BComponent>() };
+    const ECS::Entity prefab{ sut.Create() };
+    sut.Emplace<AComponent>(prefab, 1);
+    sut.Emplace<BComponent>(prefab, 2, "prefab");
+
+    std::vector<ECS::Entity> instances(4);
+    sut.Instantiate(prefab, instances.size(), instances.begin());
+
+    EXPECT_EQ(group.Size(), 5);
+    EXPECT_TRUE(group.Contains(instances[3]));
+}
+
+TEST(RegistryTest, Sort_QueryFollowsOrder)
+{
+    ECS::Registry sut;
+    for (int number : { 3, 1, 2 })
+        sut.Create<AComponent>(number);
+
+    sut.Sort<AComponent>([](const AComponent& lhs, const AComponent& rhs) {
+        return lhs.number > rhs.number;
+    });
+
+    std::vector<int> numbers{};
+    sut.QueryAll<AComponent>().Each(
+        [&numbers](AComponent& component) {
+            numbers.push_back(component.number);
+        });
+
+    EXPECT_EQ(numbers, (std::vector<int>{ 3, 2, 1 }));
+}
+
+namespace
+{
+struct Observer
+{
+    void Construct(ECS::Entity entity)
+    {
+        constructed.push_back(entity);
+    }
+
+    void Update(ECS::Entity entity)
+    {
+        updated.push_back(entity);
+    }
+
+    void Destroy(ECS::Entity entity)
+    {
+        destroyed.push_back(entity);
+    }
+
+    std::vector<ECS::Entity> constructed;
+    std::vector<ECS::Entity> updated;
+    std::vector<ECS::Entity> destroyed;
+};
+
+using Listener = ECS::Delegate<void(ECS::Entity)>;
+}
+
+TEST(RegistryTest, Signals_ConstructUpdateDestroy)
+{
+    ECS::Registry sut;
+    Observer observer;
+    sut.OnConstruct<AComponent>().Connect(
+        Listener::Bind<&Observer::Construct>(observer));
+    sut.OnUpdate<AComponent>().Connect(
+        Listener::Bind<&Observer::Update>(observer));
+    sut.OnDestroy<AComponent>().Connect(
+        Listener::Bind<&Observer::Destroy>(observer));
+
+    const ECS::Entity entity0{ sut.Create<AComponent>(1) };
+    const ECS::Entity entity1{ sut.Create<AComponent>(2) };
+    sut.Patch<AComponent>(entity1, [](AComponent& component) {
+        component.number = 3;
+    });
+    sut.Destroy(entity0);
+    sut.Erase<AComponent>(entity1);
+
+    EXPECT_EQ(observer.constructed, (std::vector{ entity0, entity1 }));
+    EXPECT_EQ(observer.updated, std::vector{ entity1 });
+    EXPECT_EQ(observer.destroyed, (std::vector{ entity0, entity1 }));
+}
+
+TEST(RegistryTest, Signals_BulkOperations)
+{
+    ECS::Registry sut;
+    Observer observer;
+    sut.OnConstruct<AComponent>().Connect(
+        Listener::Bind<&Observer::Construct>(observer));
+    sut.OnDestroy<AComponent>().Connect(
+        Listener::Bind<&Observer::Destroy>(observer));
+
+    std::vector<ECS::Entity> entities(3);
+    sut.CreateMany(entities.size(), entities.begin());
+    sut.EmplaceMany<AComponent>(entities.begin(), entities.end());
+    sut.Instantiate(entities[0], 2, std::back_inserter(entities));
+    sut.Clear();
+
+    EXPECT_EQ(observer.constructed, entities);
+    EXPECT_EQ(observer.destroyed.size(), 5);
+}
+
+TEST(RegistryTest, Signals_DestroyedComponentIsReadable)
+{
+    ECS::Registry sut;
+    int number{ 0 };
+    auto read{ [&](ECS::Entity entity) {
+        number = sut.Get<AComponent>(entity).number;
+    } };
+    sut.OnDestroy<AComponent>().Connect(Listener::Bind(read));
+
+    sut.Destroy(sut.Create<AComponent>(9));
+
+    EXPECT_EQ(number, 9);
+}
+
+TEST(RegistryTest, MemoryResource_PoolsUseResource)
+{
+    const std::size_t size{ 1u << 16 };
+    void* memory{ std::malloc(size) };
+
+    TlsfAllocator allocator{ size, memory };
+    MemoryResource resource{ allocator };
+
+    {
+        ECS::Registry sut{ &resource };
+
+        for (int i{ 0 }; i < 100; ++i)
+            sut.Create<AComponent>(AComponent{ .number = i });
+
+        EXPECT_GT(allocator.GetNumAllocations(), 0);
+        EXPECT_EQ(sut.Get<AComponent>(99).number, 99);
+    }
+
+    EXPECT_EQ(allocator.GetNumAllocations(), 0);
+
+    std::free(memory);
+}
@@ -0,0 +1,114 @@
+#include <ecs/Signal.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+int g_received{ 0 };
+
+void Receive(int value)
+{
+    g_received = value;
+}
+
+int Twice(int value)
+{
+    return value * 2;
+}
+
+struct Listener
+{
+    void Receive(int value)
+    {
+        values.push_back(value);
+    }
+
+    std::vector<int> values;
+};
+}
+
+TEST(SignalTest, Delegate_FreeFunction)
+{
+    auto sut{ ECS::Delegate<int(int)>::Bind<&Twice>() };
+
+    EXPECT_TRUE(sut);
+    EXPECT_EQ(sut(21), 42);
+}
+
+TEST(SignalTest, Delegate_Method)
+{
+    Listener listener;
+    auto sut{ ECS::Delegate<void(int)>::Bind<&Listener::Receive>(listener) };
+
+    sut(3);
+
+    EXPECT_EQ(listener.values, std::vector<int>{ 3 });
+}
+
+TEST(SignalTest, Delegate_FunctionObject)
+{
+    int sum{ 0 };
+    auto add{ [&sum](int value) { sum += value; } };
+    auto sut{ ECS::Delegate<void(int)>::Bind(add) };
+
+    sut(2);
+    sut(5);
+
+    EXPECT_EQ(sum, 7);
+}
+
+TEST(SignalTest, Delegate_Empty)
+{
+    ECS::Delegate<void(int)> sut;
+
+    EXPECT_FALSE(sut);
+}
+
+TEST(SignalTest, Publish_CallsListenersInOrder)
+{
+    ECS::Signal<int> sut;
+    Listener first;
+    Listener second;
+    sut.Connect(ECS::Delegate<void(int)>::Bind<&Listener::Receive>(first));
+    sut.Connect(ECS::Delegate<void(int)>::Bind<&Listener::Receive>(second));
+    sut.Connect(ECS::Delegate<void(int)>::Bind<&Receive>());
+
+    sut.Publish(4);
+
+    EXPECT_EQ(sut.Size(), 3);
+    EXPECT_EQ(first.values, std::vector<int>{ 4 });
+    EXPECT_EQ(second.values, std::vector<int>{ 4 });
+    EXPECT_EQ(g_received, 4);
+}
+
+TEST(SignalTest, Disconnect_StopsListener)
+{
+    ECS::Signal<int> sut;
+    Listener first;
+    Listener second;
+    const auto delegate{
+        ECS::Delegate<void(int)>::Bind<&Listener::Receive>(first)
+    };
+    sut.Connect(delegate);
+    sut.Connect(ECS::Delegate<void(int)>::Bind<&Listener::Receive>(second));
+
+    sut.Disconnect(delegate);
+    sut.Publish(1);
+
+    EXPECT_TRUE(first.values.empty());
+    EXPECT_EQ(second.values, std::vector<int>{ 1 });
+}
+
+TEST(SignalTest, Clear_Empty)
+{
+    ECS::Signal<int> sut;
+    sut.Connect(ECS::Delegate<void(int)>::Bind<&Receive>());
+
+    sut.Clear();
+
+    EXPECT_TRUE(sut.Empty());
+}
@@ -0,0 +1,327 @@
+#include <ecs/Entity.hpp>
+#include <ecs/Registry.hpp>
+#include <ecs/Snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+struct SnapshotPosition
+{
+    float x;
+    float y;
+};
+
+struct SnapshotName
+{
+    std::string value;
+};
+
+struct SnapshotTag
+{
+};
+
+ECS::Snapshot MakeSnapshot()
+{
+    ECS::Snapshot snapshot;
+    snapshot.Register<SnapshotPosition>("Position");
+    snapshot.Register<SnapshotTag>("Tag");
+    snapshot.Register<SnapshotName>(
+        "Name",
+        [](std::ostream& stream, const SnapshotName& name) {
+            const auto size{ static_cast<std::uint32_t>(name.value.size()) };
+            stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            stream.write(name.value.data(), size);
+        },
+        [](std::istream& stream, SnapshotName& name) {
+            std::uint32_t size{ 0 };
+            stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+            name.value.resize(size);
+            stream.read(name.value.data(), size);
+        });
+
+    return snapshot;
+}
+}
+
+TEST(SnapshotTest, Load_RestoresEntitiesAndComponents)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    std::vector<ECS::Entity> entities{};
+
+    for (int i{ 0 }; i < 100; ++i)
+    {
+        const ECS::Entity entity{ source.Create() };
+        const auto value{ static_cast<float>(i) };
+        source.Emplace<SnapshotPosition>(entity, value, -value);
+
+        if (i % 2 == 0)
+            source.Emplace<SnapshotName>(entity, std::to_string(i));
+
+        if (i % 3 == 0)
+            source.Emplace<SnapshotTag>(entity);
+
+        entities.push_back(entity);
+    }
+
+    // Leaves holes in the index range and bumps versions.
+    for (int i{ 0 }; i < 100; i += 7)
+    {
+        source.Destroy(entities[static_cast<std::size_t>(i)]);
+    }
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Registry destination;
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    for (int i{ 0 }; i < 100; ++i)
+    {
+        const ECS::Entity entity{ entities[static_cast<std::size_t>(i)] };
+
+        EXPECT_EQ(destination.IsValid(entity), source.IsValid(entity));
+        if (!source.IsValid(entity))
+            continue;
+
+        const auto& position{ destination.Get<SnapshotPosition>(entity) };
+        EXPECT_EQ(position.x, static_cast<float>(i));
+        EXPECT_EQ(position.y, -static_cast<float>(i));
+
+        EXPECT_EQ(
+            destination.AllOf<SnapshotName>(entity),
+            source.AllOf<SnapshotName>(entity));
+        if (source.AllOf<SnapshotName>(entity))
+        {
+            EXPECT_EQ(
+                destination.Get<SnapshotName>(entity).value,
+                std::to_string(i));
+        }
+
+        EXPECT_EQ(
+            destination.AllOf<SnapshotTag>(entity),
+            source.AllOf<SnapshotTag>(entity));
+    }
+}
+
+TEST(SnapshotTest, Load_ReusesFreeIndices)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+
+    const ECS::Entity first{ source.Create() };
+    const ECS::Entity second{ source.Create() };
+    source.Destroy(first);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Registry destination;
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    const ECS::Entity created{ destination.Create() };
+    EXPECT_EQ(ECS::entityIndex(created), ECS::entityIndex(first));
+    EXPECT_NE(created, second);
+    EXPECT_TRUE(destination.IsValid(second));
+}
+
+TEST(SnapshotTest, Load_ReplacesContent)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    source.Create<SnapshotPosition>(1.0f, 2.0f);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Registry destination;
+    for (int i{ 0 }; i < 10; ++i)
+        destination.Create<SnapshotPosition>(0.0f, 0.0f);
+
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    EXPECT_EQ(destination.QueryAll<SnapshotPosition>().Size(), 1u);
+}
+
+TEST(SnapshotTest, Load_RefreshesGroups)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+
+    for (int i{ 0 }; i < 10; ++i)
+    {
+        const ECS::Entity entity{ source.Create() };
+        source.Emplace<SnapshotPosition>(entity, 0.0f, 0.0f);
+
+        if (i % 2 == 0)
+            source.Emplace<SnapshotName>(entity, "name");
+    }
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Registry destination;
+    auto group{ destination.Group<SnapshotPosition, SnapshotName>() };
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    EXPECT_EQ(group.Size(), 5u);
+}
+
+TEST(SnapshotTest, Load_StampsCurrentTick)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    const ECS::Entity entity{ source.Create<SnapshotPosition>(0.0f, 0.0f) };
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Registry destination;
+    destination.AdvanceTick();
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    const std::uint32_t since{ destination.Tick() - 1u };
+    EXPECT_EQ(destination.QueryAll<ECS::Added<SnapshotPosition>>()
+                  .Since(since)
+                  .Size(),
+              1u);
+    EXPECT_TRUE(destination.IsValid(entity));
+}
+
+TEST(SnapshotTest, Load_ConstructListenersSeeLoadedComponents)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    const ECS::Entity entity{ source.Create<SnapshotPosition>(42.0f, 1.0f) };
+    source.Emplace<SnapshotName>(entity, "Loaded");
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    struct Observer
+    {
+        ECS::Registry* registry;
+        std::vector<float> positions;
+        std::vector<std::string> names;
+
+        void Construct(ECS::Entity constructed)
+        {
+            positions.push_back(registry->Get<SnapshotPosition>(constructed).x);
+            names.push_back(registry->Get<SnapshotName>(constructed).value);
+        }
+    };
+
+    ECS::Registry destination;
+    Observer observer{ .registry = &destination, .positions{}, .names{} };
+    destination.OnConstruct<SnapshotPosition>().Connect(
+        ECS::Delegate<void(ECS::Entity)>::Bind<&Observer::Construct>(
+            observer));
+
+    ASSERT_TRUE(snapshot.Load(destination, stream));
+
+    EXPECT_EQ(observer.positions, std::vector{ 42.0f });
+    EXPECT_EQ(observer.names, std::vector<std::string>{ "Loaded" });
+}
+
+TEST(SnapshotTest, Load_InvalidStream_Fails)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry registry;
+    registry.Create();
+
+    std::stringstream stream{ "not a snapshot" };
+    EXPECT_FALSE(snapshot.Load(registry, stream));
+    EXPECT_EQ(registry.QueryAll<SnapshotPosition>().Size(), 0u);
+}
+
+TEST(SnapshotTest, Load_TruncatedStream_Fails)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    for (int i{ 0 }; i < 10; ++i)
+        source.Create<SnapshotPosition>(0.0f, 0.0f);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    const std::string bytes{ stream.str() };
+    std::stringstream truncated{ bytes.substr(0, bytes.size() - 4u) };
+
+    ECS::Registry destination;
+    EXPECT_FALSE(snapshot.Load(destination, truncated));
+}
+
+TEST(SnapshotTest, Load_OversizedCount_Fails)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    source.Create<SnapshotPosition>(0.0f, 0.0f);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    // The entity count follows the magic and the version.
+    std::string bytes{ stream.str() };
+    const std::uint32_t entityCount{ 0xFFFFFFFFu };
+    bytes.replace(
+        8,
+        sizeof(entityCount),
+        reinterpret_cast<const char*>(&entityCount),
+        sizeof(entityCount));
+    std::stringstream corrupt{ bytes };
+
+    ECS::Registry destination;
+    EXPECT_FALSE(snapshot.Load(destination, corrupt));
+    EXPECT_EQ(destination.QueryAll<SnapshotPosition>().Size(), 0u);
+}
+
+TEST(SnapshotTest, Load_ComponentOfDeadEntity_Fails)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    source.Create<SnapshotPosition>(0.0f, 0.0f);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    // Replaces the only alive entity, which follows the 16 byte header.
+    std::string bytes{ stream.str() };
+    const ECS::Entity other{ 5 };
+    bytes.replace(
+        16,
+        sizeof(other),
+        reinterpret_cast<const char*>(&other),
+        sizeof(other));
+    std::stringstream corrupt{ bytes };
+
+    ECS::Registry destination;
+    EXPECT_FALSE(snapshot.Load(destination, corrupt));
+    EXPECT_FALSE(destination.IsValid(5));
+}
+
+TEST(SnapshotTest, Load_UnregisteredComponent_Fails)
+{
+    ECS::Snapshot snapshot{ MakeSnapshot() };
+    ECS::Registry source;
+    source.Create<SnapshotPosition>(0.0f, 0.0f);
+
+    std::stringstream stream;
+    ASSERT_TRUE(snapshot.Save(source, stream));
+
+    ECS::Snapshot other;
+    other.Register<SnapshotTag>("Tag");
+
+    ECS::Registry destination;
+    EXPECT_FALSE(other.Load(destination, stream));
+}
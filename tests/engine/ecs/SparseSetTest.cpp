@@ -186,3 +186,75 @@ TEST(SparseSetTest, Pop)
     assert(sut.Size() == 0);
     assert(sut.Empty());
 }
+
+TEST(SparseSetTest, Contains_StaleVersion)
+{
+    Zeus::ECS::SparseSet sut;
+    auto entity = Zeus::ECS::makeEntity(3, 1);
+
+    sut.Push(entity);
+
+    EXPECT_TRUE(sut.Contains(entity));
+    EXPECT_FALSE(sut.Contains(Zeus::ECS::makeEntity(3, 0)));
+    EXPECT_FALSE(sut.Contains(Zeus::ECS::makeEntity(3, 2)));
+    EXPECT_EQ(sut.Index(entity), 0);
+}
+
+TEST(SparseSetTest, Swap_UpdatesSparse)
+{
+    Zeus::ECS::SparseSet sut;
+    sut.Push(4);
+    sut.Push(7);
+    sut.Push(9);
+
+    sut.Swap(0, 2);
+
+    EXPECT_EQ(sut.Index(4), 2);
+    EXPECT_EQ(sut.Index(7), 1);
+    EXPECT_EQ(sut.Index(9), 0);
+    EXPECT_EQ(sut.Data()[0], 9);
+    EXPECT_EQ(sut.Data()[2], 4);
+}
+
+TEST(SparseSetTest, Assign_ReplacesContent)
+{
+    Zeus::ECS::SparseSet sut;
+    sut.Push(1);
+
+    sut.Assign({ 8, 5000, 3 });
+
+    EXPECT_EQ(sut.Size(), 3);
+    EXPECT_FALSE(sut.Contains(1));
+    EXPECT_EQ(sut.Index(8), 0);
+    EXPECT_EQ(sut.Index(5000), 1);
+    EXPECT_EQ(sut.Index(3), 2);
+}
+
+TEST(SparseSetTest, Push_HighIndex_AllocatesSinglePage)
+{
+    Zeus::ECS::SparseSet sut;
+    Zeus::ECS::Entity entity{ 4000000 };
+
+    sut.Push(entity);
+
+    EXPECT_EQ(sut.PageCount(), 1);
+    EXPECT_TRUE(sut.Contains(entity));
+    EXPECT_FALSE(sut.Contains(entity - 1));
+    EXPECT_FALSE(sut.Contains(1));
+    EXPECT_EQ(sut.Index(entity), 0);
+}
+
+TEST(SparseSetTest, Pop_AcrossPages)
+{
+    Zeus::ECS::SparseSet sut;
+    sut.Push(5);
+    sut.Push(10000);
+    sut.Push(20000);
+
+    sut.Pop(5);
+
+    EXPECT_EQ(sut.PageCount(), 3);
+    EXPECT_FALSE(sut.Contains(5));
+    EXPECT_EQ(sut.Index(20000), 0);
+    EXPECT_EQ(sut.Index(10000), 1);
+}
@@ -0,0 +1,153 @@
+#include <core/JobSystem.hpp>
+#include <ecs/Registry.hpp>
+#include <ecs/SystemScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+using namespace Zeus;
+
+namespace
+{
+struct SchedulerPosition
+{
+    float value;
+};
+
+struct SchedulerVelocity
+{
+    float value;
+};
+
+struct SchedulerHealth
+{
+    int value;
+};
+}
+
+TEST(SystemSchedulerTest, Add_IndependentSystems_NoDependency)
+{
+    ECS::SystemScheduler sut;
+
+    auto first = sut.Add<ECS::Read<SchedulerVelocity>>([](auto&) {});
+    auto second = sut.Add<ECS::Read<SchedulerVelocity>>([](auto&) {});
+    auto third =
+        sut.Add<ECS::Read<>, ECS::Write<SchedulerHealth>>([](auto&) {});
+
+    EXPECT_EQ(sut.Size(), 3);
+    EXPECT_FALSE(sut.DependsOn(second, first));
+    EXPECT_FALSE(sut.DependsOn(third, first));
+    EXPECT_FALSE(sut.DependsOn(third, second));
+}
+
+TEST(SystemSchedulerTest, Add_ConflictingAccess_DependsOnEarlier)
+{
+    ECS::SystemScheduler sut;
+
+    auto reader = sut.Add<ECS::Read<SchedulerPosition>>([](auto&) {});
+    auto writer = sut.Add<ECS::Read<SchedulerVelocity>,
+                          ECS::Write<SchedulerPosition>>([](auto&) {});
+    auto secondWriter =
+        sut.Add<ECS::Read<>, ECS::Write<SchedulerPosition>>([](auto&) {});
+    auto velocityWriter =
+        sut.Add<ECS::Read<>, ECS::Write<SchedulerVelocity>>([](auto&) {});
+
+    EXPECT_TRUE(sut.DependsOn(writer, reader));
+    EXPECT_TRUE(sut.DependsOn(secondWriter, writer));
+    EXPECT_TRUE(sut.DependsOn(velocityWriter, writer));
+    EXPECT_FALSE(sut.DependsOn(reader, writer));
+    EXPECT_FALSE(sut.DependsOn(velocityWriter, reader));
+}
+
+TEST(SystemSchedulerTest, Run_NotInitialized_RunsEverySystem)
+{
+    ECS::Registry registry;
+    ECS::SystemScheduler sut;
+    int runs{ 0 };
+
+    sut.Add<ECS::Read<SchedulerVelocity>>([&](auto&) { ++runs; });
+    sut.Add<ECS::Read<SchedulerVelocity>>([&](auto&) { ++runs; });
+    sut.Add<ECS::Read<>, ECS::Write<SchedulerHealth>>([&](auto&) { ++runs; });
+
+    sut.Run(registry);
+    sut.Run(registry);
+
+    EXPECT_EQ(runs, 6);
+}
+
+TEST(SystemSchedulerTest, Run_ConflictingWrites_RegistrationOrder)
+{
+    JobSystem::Initialize(3);
+
+    ECS::Registry registry;
+    ECS::SystemScheduler sut;
+    std::vector<std::size_t> order{};
+    std::mutex mutex;
+
+    for (std::size_t i{ 0 }; i < 16; ++i)
+    {
+        // Unrelated readers in between must not break the ordering.
+        sut.Add<ECS::Read<SchedulerVelocity>>([](auto&) {});
+        sut.Add<ECS::Read<>, ECS::Write<SchedulerPosition>>([&, i](auto&) {
+            std::lock_guard lock{ mutex };
+            order.push_back(i);
+        });
+    }
+
+    sut.Run(registry);
+
+    JobSystem::Shutdown();
+
+    ASSERT_EQ(order.size(), 16);
+    for (std::size_t i{ 0 }; i < order.size(); ++i)
+    {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST(SystemSchedulerTest, Run_UpdatesComponents)
+{
+    JobSystem::Initialize(3);
+
+    ECS::Registry registry;
+    for (ECS::Entity i{ 0 }; i < 1000; ++i)
+    {
+        ECS::Entity entity{ registry.Create() };
+        registry.Emplace<SchedulerPosition>(entity, 0.0f);
+        registry.Emplace<SchedulerVelocity>(entity, 1.0f);
+        registry.Emplace<SchedulerHealth>(entity, 10);
+    }
+
+    ECS::SystemScheduler sut;
+    sut.Add<ECS::Read<>, ECS::Write<SchedulerVelocity>>(
+        [](ECS::Registry& registry) {
+            registry.QueryAll<SchedulerVelocity>().Each(
+                [](SchedulerVelocity& velocity) { velocity.value *= 2.0f; });
+        });
+    sut.Add<ECS::Read<SchedulerVelocity>, ECS::Write<SchedulerPosition>>(
+        [](ECS::Registry& registry) {
+            registry.QueryAll<SchedulerPosition, SchedulerVelocity>()
+                .Each([](SchedulerPosition& position,
+                         SchedulerVelocity& velocity) {
+                    position.value += velocity.value;
+                });
+        });
+    sut.Add<ECS::Read<>, ECS::Write<SchedulerHealth>>(
+        [](ECS::Registry& registry) {
+            registry.QueryAll<SchedulerHealth>().Each(
+                [](SchedulerHealth& health) { --health.value; });
+        });
+
+    sut.Run(registry);
+
+    JobSystem::Shutdown();
+
+    registry.QueryAll<SchedulerPosition, SchedulerHealth>().Each(
+        [](SchedulerPosition& position, SchedulerHealth& health) {
+            EXPECT_EQ(position.value, 2.0f);
+            EXPECT_EQ(health.value, 9);
+        });
+}
@@ -0,0 +1,74 @@
+#include <memory/FrameAllocator.hpp>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+
+TEST(FrameAllocatorTest, Getters)
+{
+    auto frameSize{ 64u };
+    void* memStart{ std::malloc(3 * frameSize) };
+
+    auto sut{ Zeus::FrameAllocator(frameSize, 3, memStart) };
+
+    EXPECT_EQ(sut.GetSize(), 3 * frameSize);
+    EXPECT_EQ(sut.GetStart(), memStart);
+    EXPECT_EQ(sut.GetFrameCount(), 3);
+    EXPECT_EQ(sut.GetFrameIndex(), 0);
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetFrame(1).GetStart(), static_cast<char*>(memStart) + 64);
+
+    std::free(memStart);
+}
+
+TEST(FrameAllocatorTest, Allocate_UsesCurrentFrame)
+{
+    auto frameSize{ 64u };
+    void* memStart{ std::malloc(2 * frameSize) };
+
+    auto sut{ Zeus::FrameAllocator(frameSize, 2, memStart) };
+
+    sut.BeginFrame(1);
+    auto ptr{ sut.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t)) };
+
+    EXPECT_EQ(ptr, sut.GetFrame(1).GetStart());
+    EXPECT_EQ(sut.GetFrame(0).GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetFrame(1).GetUsedBytes(), sizeof(std::uint64_t));
+    EXPECT_EQ(sut.GetUsedBytes(), sizeof(std::uint64_t));
+    EXPECT_EQ(sut.GetNumAllocations(), 1);
+
+    std::free(memStart);
+}
+
+TEST(FrameAllocatorTest, BeginFrame_ClearsOnlyThatFrame)
+{
+    auto frameSize{ 64u };
+    void* memStart{ std::malloc(2 * frameSize) };
+
+    auto sut{ Zeus::FrameAllocator(frameSize, 2, memStart) };
+
+    sut.BeginFrame(0);
+    auto first{ static_cast<std::uint64_t*>(
+        sut.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t))) };
+    *first = 42;
+
+    sut.BeginFrame(1);
+    sut.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+    sut.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t));
+
+    // Frame 0 is still in flight.
+    EXPECT_EQ(*first, 42);
+    EXPECT_EQ(sut.GetNumAllocations(), 3);
+
+    sut.BeginFrame(0);
+
+    EXPECT_EQ(sut.GetFrame(0).GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetUsedBytes(), 2 * sizeof(std::uint64_t));
+    EXPECT_EQ(sut.GetNumAllocations(), 2);
+    EXPECT_EQ(
+        sut.Allocate(sizeof(std::uint64_t), alignof(std::uint64_t)),
+        first);
+
+    std::free(memStart);
+}
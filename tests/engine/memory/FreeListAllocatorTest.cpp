@@ -143,3 +143,17 @@ TEST(FreeListAllocatorTest, Free_First)
 
     std::free(memStart);
 }
+
+TEST(FreeListAllocatorTest, Allocate_OutOfMemory_ReturnsNullptr)
+{
+    auto maxSize{ 128u };
+    void* memStart{ std::malloc(maxSize) };
+
+    Zeus::FreeListAllocator sut{ maxSize, memStart };
+
+    EXPECT_EQ(sut.Allocate(maxSize), nullptr);
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    std::free(memStart);
+}
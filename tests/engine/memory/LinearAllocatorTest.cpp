@@ -172,3 +172,18 @@ TEST(LinearAllocatorTest, Rewind_AllAllocation)
 
     std::free(memStart);
 }
+
+TEST(LinearAllocatorTest, Allocate_OutOfMemory_ReturnsNullptr)
+{
+    auto maxSize{ sizeof(TestClassA) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::LinearAllocator(maxSize, memStart) };
+    sut.Allocate(sizeof(TestClassA), alignof(TestClassA));
+
+    EXPECT_EQ(sut.Allocate(sizeof(TestClassA), alignof(TestClassA)), nullptr);
+    EXPECT_EQ(sut.GetUsedBytes(), sizeof(TestClassA));
+    EXPECT_EQ(sut.GetNumAllocations(), 1);
+
+    std::free(memStart);
+}
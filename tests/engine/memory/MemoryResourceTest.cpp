@@ -0,0 +1,96 @@
+#include <memory/LinearAllocator.hpp>
+#include <memory/MemoryResource.hpp>
+#include <memory/TlsfAllocator.hpp>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+TEST(MemoryResourceTest, Allocate_FromAllocator)
+{
+    auto maxSize{ 1024u };
+    void* memStart{ std::malloc(maxSize) };
+
+    Zeus::LinearAllocator allocator{ maxSize, memStart };
+    Zeus::MemoryResource sut{ allocator };
+
+    std::pmr::vector<std::uint32_t> values{ &sut };
+    values.reserve(16);
+    values.push_back(42);
+
+    EXPECT_EQ(static_cast<const void*>(values.data()), memStart);
+    EXPECT_EQ(allocator.GetUsedBytes(), 16 * sizeof(std::uint32_t));
+    EXPECT_EQ(&sut.GetAllocator(), &allocator);
+
+    std::free(memStart);
+}
+
+TEST(MemoryResourceTest, Deallocate_FreesToAllocator)
+{
+    auto maxSize{ 4096u };
+    void* memStart{ std::malloc(maxSize) };
+
+    Zeus::TlsfAllocator allocator{ maxSize, memStart };
+    Zeus::MemoryResource sut{ allocator };
+
+    {
+        std::pmr::vector<std::uint64_t> values{ &sut };
+        for (std::uint64_t i{ 0 }; i < 100; ++i)
+            values.push_back(i);
+
+        EXPECT_EQ(allocator.GetNumAllocations(), 1);
+    }
+
+    EXPECT_EQ(allocator.GetUsedBytes(), 0);
+    EXPECT_EQ(allocator.GetNumAllocations(), 0);
+
+    std::free(memStart);
+}
+
+TEST(MemoryResourceTest, Allocate_ExhaustedThrows)
+{
+    auto maxSize{ 256u };
+    void* memStart{ std::malloc(maxSize) };
+
+    Zeus::TlsfAllocator allocator{ maxSize, memStart };
+    Zeus::MemoryResource sut{ allocator };
+
+    EXPECT_THROW((void)sut.allocate(1024), std::bad_alloc);
+
+    std::free(memStart);
+}
+
+TEST(MemoryResourceTest, Allocate_LinearExhaustedThrows)
+{
+    auto maxSize{ 256u };
+    void* memStart{ std::malloc(maxSize) };
+
+    Zeus::LinearAllocator allocator{ maxSize, memStart };
+    Zeus::MemoryResource sut{ allocator };
+
+    EXPECT_THROW((void)sut.allocate(1024), std::bad_alloc);
+    EXPECT_EQ(allocator.GetUsedBytes(), 0);
+
+    std::free(memStart);
+}
+
+TEST(MemoryResourceTest, IsEqual_SameAllocator)
+{
+    auto maxSize{ 256u };
+    void* memStart{ std::malloc(2 * maxSize) };
+
+    Zeus::LinearAllocator allocator{ maxSize, memStart };
+    Zeus::LinearAllocator other{ maxSize, static_cast<char*>(memStart) + 256 };
+
+    Zeus::MemoryResource sut{ allocator };
+
+    EXPECT_TRUE(sut.is_equal(Zeus::MemoryResource{ allocator }));
+    EXPECT_FALSE(sut.is_equal(Zeus::MemoryResource{ other }));
+    EXPECT_FALSE(sut.is_equal(*std::pmr::new_delete_resource()));
+
+    std::free(memStart);
+}
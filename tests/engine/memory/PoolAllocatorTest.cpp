@@ -0,0 +1,190 @@
+#include <memory/PoolAllocator.hpp>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+namespace
+{
+struct TestSlot
+{
+    std::uint64_t a;
+    std::uint32_t b;
+};
+}
+
+TEST(PoolAllocatorTest, Getters)
+{
+    auto maxSize{ 10u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart) };
+
+    EXPECT_EQ(sut.GetSize(), maxSize);
+    EXPECT_EQ(sut.GetStart(), memStart);
+    EXPECT_EQ(sut.GetSlotSize(), sizeof(TestSlot));
+    EXPECT_EQ(sut.GetSlotCount(), 10);
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    std::free(memStart);
+}
+
+TEST(PoolAllocatorTest, Allocate_DistinctSlots)
+{
+    auto maxSize{ 64u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart) };
+
+    std::set<void*> slots;
+    for (std::uint32_t i{ 0 }; i < sut.GetSlotCount(); ++i)
+    {
+        auto slot{ reinterpret_cast<TestSlot*>(
+            sut.Allocate(sizeof(TestSlot), alignof(TestSlot))) };
+
+        ASSERT_NE(slot, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(slot) % alignof(TestSlot),
+                  0u);
+
+        slot->a = i;
+        slot->b = i;
+        slots.insert(slot);
+    }
+
+    EXPECT_EQ(slots.size(), sut.GetSlotCount());
+    EXPECT_EQ(sut.GetUsedBytes(), maxSize);
+    EXPECT_EQ(sut.Allocate(sizeof(TestSlot), alignof(TestSlot)), nullptr);
+
+    std::free(memStart);
+}
+
+TEST(PoolAllocatorTest, Free_ReusesSlot)
+{
+    auto maxSize{ 4u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart) };
+
+    auto first{ sut.Allocate(sizeof(TestSlot), alignof(TestSlot)) };
+    auto second{ sut.Allocate(sizeof(TestSlot), alignof(TestSlot)) };
+
+    sut.Free(first);
+
+    EXPECT_EQ(sut.Allocate(sizeof(TestSlot), alignof(TestSlot)), first);
+    EXPECT_EQ(sut.GetNumAllocations(), 2);
+
+    sut.Free(first);
+    sut.Free(second);
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+
+    std::free(memStart);
+}
+
+TEST(PoolAllocatorTest, Allocate_ChainedGrowth)
+{
+    auto maxSize{ 4u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart,
+        Zeus::PoolGrowth::Chained) };
+
+    std::vector<TestSlot*> slots;
+    for (std::uint32_t i{ 0 }; i < 20; ++i)
+    {
+        auto slot{ reinterpret_cast<TestSlot*>(
+            sut.Allocate(sizeof(TestSlot), alignof(TestSlot))) };
+        ASSERT_NE(slot, nullptr);
+
+        slot->a = i;
+        slots.push_back(slot);
+    }
+
+    EXPECT_GE(sut.GetSlotCount(), 20);
+    EXPECT_GT(sut.GetSize(), maxSize);
+
+    for (std::uint32_t i{ 0 }; i < 20; ++i)
+    {
+        EXPECT_EQ(slots[i]->a, i);
+        sut.Free(slots[i]);
+    }
+
+    std::free(memStart);
+}
+
+TEST(PoolAllocatorTest, MoveAssign_GrownPool)
+{
+    auto maxSize{ 4u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+    void* otherStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart,
+        Zeus::PoolGrowth::Chained) };
+
+    for (std::uint32_t i{ 0 }; i < 20; ++i)
+        ASSERT_NE(sut.Allocate(sizeof(TestSlot), alignof(TestSlot)), nullptr);
+
+    ASSERT_GT(sut.GetSize(), maxSize);
+
+    sut = Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        otherStart);
+
+    EXPECT_EQ(sut.GetStart(), otherStart);
+    EXPECT_EQ(sut.GetSize(), maxSize);
+    EXPECT_EQ(sut.GetSlotCount(), 4);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    std::free(memStart);
+    std::free(otherStart);
+}
+
+#ifndef NDEBUG
+TEST(PoolAllocatorTest, Free_PoisonsSlot)
+{
+    auto maxSize{ 4u * sizeof(TestSlot) };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::PoolAllocator(
+        sizeof(TestSlot),
+        alignof(TestSlot),
+        maxSize,
+        memStart) };
+
+    auto slot{ reinterpret_cast<TestSlot*>(
+        sut.Allocate(sizeof(TestSlot), alignof(TestSlot))) };
+    slot->b = 42;
+
+    sut.Free(slot);
+
+    // The first bytes link the free list, the rest is poisoned.
+    EXPECT_EQ(slot->b, 0xDDDDDDDDu);
+
+    std::free(memStart);
+}
+#endif
@@ -0,0 +1,86 @@
+#include <memory/ScratchScope.hpp>
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+TEST(ScratchScopeTest, End_ReleasesAllocations)
+{
+    const auto used{ Zeus::ScratchScope::Arena().GetUsedBytes() };
+
+    {
+        Zeus::ScratchScope sut;
+        auto values{ sut.Allocate<std::uint64_t>(16) };
+        values[15] = 42;
+
+        EXPECT_EQ(values[15], 42);
+        EXPECT_GE(
+            Zeus::ScratchScope::Arena().GetUsedBytes(),
+            used + 16 * sizeof(std::uint64_t));
+    }
+
+    EXPECT_EQ(Zeus::ScratchScope::Arena().GetUsedBytes(), used);
+}
+
+TEST(ScratchScopeTest, Nested_RewindsToOwnMark)
+{
+    Zeus::ScratchScope outer;
+    auto first{ outer.Allocate<std::uint32_t>(4) };
+    first[0] = 7;
+
+    const void* mark{ Zeus::ScratchScope::Arena().GetCurrent() };
+
+    {
+        Zeus::ScratchScope inner;
+        inner.Allocate<std::uint32_t>(64);
+    }
+
+    EXPECT_EQ(Zeus::ScratchScope::Arena().GetCurrent(), mark);
+    EXPECT_EQ(first[0], 7);
+
+    // The memory released by the inner scope is handed out again.
+    Zeus::ScratchScope inner;
+    EXPECT_EQ(inner.Allocate<std::uint32_t>(1), mark);
+}
+
+TEST(ScratchScopeTest, HighWaterMark_KeepsPeak)
+{
+    Zeus::ScratchScope::ResetHighWaterMark();
+    const auto base{ Zeus::ScratchScope::HighWaterMark() };
+
+    {
+        Zeus::ScratchScope sut;
+        sut.Allocate(1024, 1);
+    }
+
+    {
+        Zeus::ScratchScope sut;
+        sut.Allocate(16, 1);
+    }
+
+    EXPECT_EQ(Zeus::ScratchScope::HighWaterMark(), base + 1024);
+
+    Zeus::ScratchScope::ResetHighWaterMark();
+    EXPECT_EQ(Zeus::ScratchScope::HighWaterMark(), base);
+}
+
+TEST(ScratchScopeTest, Arena_PerThread)
+{
+    const void* mainArena{ Zeus::ScratchScope::Arena().GetStart() };
+    const void* otherArena{ nullptr };
+    std::size_t otherPeak{ 0 };
+
+    std::thread thread{ [&otherArena, &otherPeak]() {
+        Zeus::ScratchScope sut;
+        sut.Allocate(256, 1);
+
+        otherArena = Zeus::ScratchScope::Arena().GetStart();
+        otherPeak = Zeus::ScratchScope::HighWaterMark();
+    } };
+    thread.join();
+
+    EXPECT_NE(otherArena, mainArena);
+    EXPECT_EQ(otherPeak, 256);
+}
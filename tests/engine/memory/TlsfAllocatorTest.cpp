@@ -0,0 +1,155 @@
+#include <memory/TlsfAllocator.hpp>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+template <typename T>
+static void Allocate_PrimitiveTypes_testPrimitiveType(Zeus::TlsfAllocator& sut)
+{
+    auto actualVoid{ sut.Allocate(sizeof(T), alignof(T)) };
+    auto actualPtr{ reinterpret_cast<T*>(actualVoid) };
+
+    auto limits{ std::numeric_limits<T>() };
+
+    *actualPtr = limits.max();
+    EXPECT_EQ(*actualPtr, limits.max());
+
+    *actualPtr = limits.min();
+    EXPECT_EQ(*actualPtr, limits.min());
+}
+
+TEST(TlsfAllocatorTest, Allocate_PrimitiveTypes)
+{
+    auto maxSize{ 1024u };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::TlsfAllocator(maxSize, memStart) };
+
+    Allocate_PrimitiveTypes_testPrimitiveType<long long>(sut);
+    Allocate_PrimitiveTypes_testPrimitiveType<float>(sut);
+    Allocate_PrimitiveTypes_testPrimitiveType<int>(sut);
+    Allocate_PrimitiveTypes_testPrimitiveType<bool>(sut);
+
+    EXPECT_EQ(sut.GetSize(), maxSize);
+    EXPECT_EQ(sut.GetStart(), memStart);
+    EXPECT_EQ(sut.GetNumAllocations(), 4);
+    EXPECT_GT(sut.GetUsedBytes(), 0);
+
+    std::free(memStart);
+}
+
+TEST(TlsfAllocatorTest, Allocate_Alignment)
+{
+    auto maxSize{ 8192u };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::TlsfAllocator(maxSize, memStart) };
+
+    for (std::uintptr_t alignment{ 1 }; alignment <= 512; alignment *= 2)
+    {
+        auto ptr{ sut.Allocate(24, alignment) };
+
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+    }
+
+    std::free(memStart);
+}
+
+TEST(TlsfAllocatorTest, Free_Coalesces)
+{
+    auto maxSize{ 4096u };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::TlsfAllocator(maxSize, memStart) };
+
+    auto first{ sut.Allocate(1000) };
+    auto second{ sut.Allocate(1000) };
+    auto third{ sut.Allocate(1000) };
+
+    // Neither gap can serve it until the neighbours merge.
+    sut.Free(first);
+    sut.Free(third);
+    EXPECT_EQ(sut.Allocate(3000), nullptr);
+
+    sut.Free(second);
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    auto whole{ sut.Allocate(3000) };
+    EXPECT_NE(whole, nullptr);
+    sut.Free(whole);
+
+    std::free(memStart);
+}
+
+TEST(TlsfAllocatorTest, Allocate_ExhaustedReturnsNull)
+{
+    auto maxSize{ 256u };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::TlsfAllocator(maxSize, memStart) };
+
+    EXPECT_EQ(sut.Allocate(512), nullptr);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    std::free(memStart);
+}
+
+TEST(TlsfAllocatorTest, RandomChurn_KeepsAllocationsIntact)
+{
+    auto maxSize{ 1u << 20 };
+    void* memStart{ std::malloc(maxSize) };
+
+    auto sut{ Zeus::TlsfAllocator(maxSize, memStart) };
+
+    struct Allocation
+    {
+        std::uint8_t* ptr;
+        std::size_t size;
+    };
+
+    std::vector<Allocation> allocations(256, { nullptr, 0 });
+    std::mt19937 random{ 42 };
+
+    for (std::uint32_t i{ 0 }; i < 10000; ++i)
+    {
+        auto& allocation{ allocations[random() % allocations.size()] };
+
+        if (allocation.ptr != nullptr)
+        {
+            const auto fill{ static_cast<std::uint8_t>(allocation.size) };
+            for (std::size_t j{ 0 }; j < allocation.size; ++j)
+                ASSERT_EQ(allocation.ptr[j], fill);
+
+            sut.Free(allocation.ptr);
+        }
+
+        allocation.size = 1 + random() % 2048;
+        allocation.ptr = static_cast<std::uint8_t*>(
+            sut.Allocate(allocation.size, std::uintptr_t{ 1 } << (i % 7)));
+        ASSERT_NE(allocation.ptr, nullptr);
+
+        std::memset(
+            allocation.ptr,
+            static_cast<std::uint8_t>(allocation.size),
+            allocation.size);
+    }
+
+    for (const Allocation& allocation : allocations)
+    {
+        if (allocation.ptr != nullptr)
+            sut.Free(allocation.ptr);
+    }
+
+    EXPECT_EQ(sut.GetUsedBytes(), 0);
+    EXPECT_EQ(sut.GetNumAllocations(), 0);
+
+    std::free(memStart);
+}